@@ -92,8 +92,9 @@ QA_Result SystemInitialize(void) {
   //----------------------------
   //Initialize Peripheral Clocks
   RCC_PeriphCLKInitTypeDef RCC_PeriphClkInit = {0};
-  RCC_PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USB;
+  RCC_PeriphClkInit.PeriphClockSelection = RCC_PERIPHCLK_USB | RCC_PERIPHCLK_ADC;
   RCC_PeriphClkInit.UsbClockSelection    = RCC_USBCLKSOURCE_PLL_DIV1_5;
+  RCC_PeriphClkInit.AdcClockSelection    = RCC_ADCPCLK2_DIV6;            //12MHz ADC clock from 72MHz PCLK2 (14MHz maximum)
 
   if (HAL_RCCEx_PeriphCLKConfig(&RCC_PeriphClkInit) != HAL_OK) {
   	return QA_Fail;
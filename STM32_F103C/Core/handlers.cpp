@@ -18,6 +18,9 @@
 //Includes
 #include "handlers.hpp"
 
+#include "QAD_Timestamp.hpp"
+#include "QAD_EXTIMgr.hpp"
+
 
 	//------------------------------------------
 	//------------------------------------------
@@ -88,6 +91,7 @@ void  PendSV_Handler(void) {
 //Exception Handler Function
 void  SysTick_Handler(void) {
   HAL_IncTick();
+  QAD_Timestamp::update();  //Keep 64bit extended cycle count up to date
 }
 
 
@@ -99,3 +103,51 @@ void  SysTick_Handler(void) {
 	//---------------------------
 	//Interrupt Handler Functions
 
+
+//EXTI0_IRQHandler
+//Interrupt Handler Function
+void  EXTI0_IRQHandler(void) {
+	QAD_EXTIMgr::dispatch(QAD_EXTI_LINES_0);
+}
+
+
+//EXTI1_IRQHandler
+//Interrupt Handler Function
+void  EXTI1_IRQHandler(void) {
+	QAD_EXTIMgr::dispatch(QAD_EXTI_LINES_1);
+}
+
+
+//EXTI2_IRQHandler
+//Interrupt Handler Function
+void  EXTI2_IRQHandler(void) {
+	QAD_EXTIMgr::dispatch(QAD_EXTI_LINES_2);
+}
+
+
+//EXTI3_IRQHandler
+//Interrupt Handler Function
+void  EXTI3_IRQHandler(void) {
+	QAD_EXTIMgr::dispatch(QAD_EXTI_LINES_3);
+}
+
+
+//EXTI4_IRQHandler
+//Interrupt Handler Function
+void  EXTI4_IRQHandler(void) {
+	QAD_EXTIMgr::dispatch(QAD_EXTI_LINES_4);
+}
+
+
+//EXTI9_5_IRQHandler
+//Interrupt Handler Function
+void  EXTI9_5_IRQHandler(void) {
+	QAD_EXTIMgr::dispatch(QAD_EXTI_LINES_9_5);
+}
+
+
+//EXTI15_10_IRQHandler
+//Interrupt Handler Function
+void  EXTI15_10_IRQHandler(void) {
+	QAD_EXTIMgr::dispatch(QAD_EXTI_LINES_15_10);
+}
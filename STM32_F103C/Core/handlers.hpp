@@ -48,6 +48,14 @@ void  SysTick_Handler(void);
 	//---------------------------
 	//Interrupt Handler Functions
 
+void  EXTI0_IRQHandler(void);
+void  EXTI1_IRQHandler(void);
+void  EXTI2_IRQHandler(void);
+void  EXTI3_IRQHandler(void);
+void  EXTI4_IRQHandler(void);
+void  EXTI9_5_IRQHandler(void);
+void  EXTI15_10_IRQHandler(void);
+
 }
 
 
@@ -21,6 +21,7 @@
 
 #include "QAD_GPIO.hpp"
 #include "QAD_EXTI.hpp"
+#include "QAD_Timestamp.hpp"
 
 
 	//------------------------------------------
@@ -28,7 +29,8 @@
 	//------------------------------------------
 
 //User LED driver class (driver defined in QAD_GPIO.hpp)
-QAD_GPIO_Output* GPIO_UserLED;
+//The pin is bound at compile time, so each toggle of the LED is a single read of ODR and store to BSRR
+typedef QAD_Pin<QAD_USERLED_GPIO_PORTBASE, QAD_USERLED_GPIO_PIN> GPIO_UserLED;
 
 
 //Task Timing
@@ -67,12 +69,17 @@ int main(void) {
 
 
 	//----------------------------------
-	//Initialize the User LED using the QAD_GPIO_Output driver class.
-	//QAD_USERLED_GPIO_PORTand QAD_USERLED_GPIO_PIN are defined in setup.hpp
-  GPIO_UserLED   = new QAD_GPIO_Output(QAD_USERLED_GPIO_PORT, QAD_USERLED_GPIO_PIN,
-  		                                 QAD_GPIO_OutputMode_OpenDrain,
-																			 QAD_GPIO_PullMode_NoPull,
-																			 QAD_GPIO_Speed_Low);
+	//Initialize the DWT cycle counter based timestamp driver (driver defined in QAD_Timestamp.hpp)
+	//This is done once the system clocks have been configured, as the core clock frequency is used for time conversions
+	QAD_Timestamp::init();
+
+
+	//----------------------------------
+	//Initialize the User LED using the QAD_Pin driver class.
+	//QAD_USERLED_GPIO_PORTBASE and QAD_USERLED_GPIO_PIN are defined in setup.hpp
+  GPIO_UserLED::initOutput(QAD_GPIO_OutputMode_OpenDrain,
+  		                     QAD_GPIO_PullMode_NoPull,
+  		                     QAD_GPIO_Speed_Low);
 
 
   //----------------------------------
@@ -83,8 +90,7 @@ int main(void) {
   //Create processing loop timing variables
 	uint32_t uTicks;
 	uint32_t uCurTick;
-	uint32_t uNewTick = HAL_GetTick();
-	uint32_t uOldTick = uNewTick;
+	uint32_t uOldTick = HAL_GetTick();
 
   //Create task timing variables
 	uint32_t uHeartbeatTicks = 0;
@@ -97,19 +103,10 @@ int main(void) {
 		//Frame Timing
 		//Calculates how many ticks (in milliseconds) have passed since the previous loop, this value is placed into the uTicks variable
 		//uTicks is then used to calculate task timing below
+		//Unsigned subtraction gives the correct result across a 32bit overflow of the tick counter
     uCurTick = HAL_GetTick();
-    if (uCurTick != uNewTick) { //Handle loop faster than 1ms issue
-    	uOldTick = uNewTick;
-    	uNewTick = uCurTick;
-    	if (uNewTick < uOldTick) { //Handle 32bit overflow issue
-    		uTicks = (uNewTick + (0xFFFFFFFF - uOldTick));
-    	} else {
-    		uTicks = (uNewTick - uOldTick);
-    	}
-
-    } else {
-    	uTicks = 0;
-    }
+    uTicks   = (uCurTick - uOldTick);
+    uOldTick = uCurTick;
 
   	//----------------------------------
     //Update Heartbeat LED
@@ -117,7 +114,7 @@ int main(void) {
     //become stuck in an exception or interrupt handler
     uHeartbeatTicks += uTicks;
     if (uHeartbeatTicks >= QA_FT_HeartbeatTickThreshold) { //If heartbeat ticks has exceeded threshold then update heartbeat LED
-    	GPIO_UserLED->toggle();
+    	GPIO_UserLED::toggle();
     	uHeartbeatTicks -= QA_FT_HeartbeatTickThreshold;     //Reset heartbeat ticks
     }
 
@@ -71,6 +71,24 @@ public:
 };
 
 
+	//----------------------------------------
+	//----------------------------------------
+	//----------------------------------------
+
+	//-----------------
+	//Clock Definitions
+	//
+	//These must match the oscillator and bus clock configuration performed by SystemInitialize() in boot.cpp
+	//They allow peripheral clock speeds to be known at compile time, rather than read back from the RCC at runtime
+
+#define QAD_CLOCK_SYSCLK         (HSE_VALUE * 9)            //72MHz - 8MHz HSE with PLL x9
+#define QAD_CLOCK_HCLK           (QAD_CLOCK_SYSCLK / 1)     //72MHz - AHB prescaler /1
+#define QAD_CLOCK_PCLK1          (QAD_CLOCK_HCLK / 2)       //36MHz - APB1 prescaler /2
+#define QAD_CLOCK_PCLK2          (QAD_CLOCK_HCLK / 1)       //72MHz - APB2 prescaler /1
+#define QAD_CLOCK_TIMPCLK1       (QAD_CLOCK_PCLK1 * 2)      //72MHz - APB1 timer clocks are doubled as APB1 prescaler is not /1
+#define QAD_CLOCK_TIMPCLK2       (QAD_CLOCK_PCLK2 * 1)      //72MHz - APB2 timer clocks are not doubled as APB2 prescaler is /1
+
+
 	//----------------------------------------
 	//----------------------------------------
 	//----------------------------------------
@@ -81,6 +99,7 @@ public:
 //User LED
 #define QAD_USERLED_GPIO_PORT           GPIOC
 #define QAD_USERLED_GPIO_PIN            GPIO_PIN_13   // C13
+#define QAD_USERLED_GPIO_PORTBASE       GPIOC_BASE    //Port base address used by the QAD_Pin template class (defined in QAD_GPIO.hpp)
 
 
 	//------------------------------------------
@@ -0,0 +1,501 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: ADC Driver                                                      */
+/*   Filename: QAD_ADC.cpp                                                 */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_ADC.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+  //------------------------------
+  //------------------------------
+  //QAD_ADC Initialization Methods
+
+//QAD_ADC::init
+//QAD_ADC Initialization Method
+//
+//Used to initialize the ADC driver
+//If QAD_TimerNone was selected in the initialization structure, an available timer with ADC triggering support is allocated
+//Returns QA_OK if initialization successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
+QA_Result QAD_ADC::init(void) {
+
+	//Select trigger timer
+	m_eTimer = m_eTimerSelect;
+	if (m_eTimer == QAD_TimerNone) {
+		m_eTimer = QAD_TimerMgr::findTimerADC();
+		if (m_eTimer == QAD_TimerNone)
+			return QA_Error_PeriphBusy;
+	} else if (!QAD_TimerMgr::getADC(m_eTimer)) {
+		return QA_Error_PeriphNotSupported;
+	}
+
+	//Check if selected Timer peripheral is currently available
+	if (QAD_TimerMgr::getState(m_eTimer))
+		return QA_Error_PeriphBusy;
+
+	//Claim DMA channel, which also prevents ADC1 being used by more than one driver instance
+	if (QAD_DMAMgr::registerChannel(QAD_DMA1_Channel1))
+		return QA_Error_PeriphBusy;
+
+	//Register Timer peripheral as now being in use
+	QAD_TimerMgr::registerTimer(m_eTimer, QAD_Timer_InUse_ADC);
+
+	//Initialize the peripherals
+	QA_Result eRes = periphInit();
+
+	//If initialization failed then deregister the Timer peripheral and DMA channel
+	if (eRes) {
+		QAD_TimerMgr::deregisterTimer(m_eTimer);
+		QAD_DMAMgr::deregisterChannel(QAD_DMA1_Channel1);
+	}
+
+	//Return initialization result
+	return eRes;
+}
+
+
+//QAD_ADC::deinit
+//QAD_ADC Initialization Method
+//
+//Used to deinitialize the ADC driver
+void QAD_ADC::deinit(void) {
+
+	//Return if ADC driver is not currently initialized
+	if (!m_eInitState)
+		return;
+
+	//Deinitialize ADC driver
+	periphDeinit(DeinitFull);
+
+	//Deregister Timer peripheral and DMA channel
+	QAD_TimerMgr::deregisterTimer(m_eTimer);
+	QAD_DMAMgr::deregisterChannel(QAD_DMA1_Channel1);
+}
+
+
+  //---------------------------
+  //---------------------------
+  //QAD_ADC IRQ Handler Methods
+
+//QAD_ADC::handler
+//QAD_ADC IRQ Handler Method
+//
+//To be called from DMA1_Channel1_IRQHandler() in handlers.cpp
+//Processes the completed half of the DMA buffer when a half transfer or transfer complete flag is set
+//If both flags are set then the interrupt has been held off for longer than half of the buffer period, and both halves are processed
+//in order, although the first half will have already been partially overwritten
+void QAD_ADC::handler(void) {
+	uint8_t uEvents = QAD_DMAMgr::getBufferEvents(&m_sDMA);
+
+	//Half Transfer
+	if (uEvents & QAD_DMA_Event_Half)
+		processHalf(QAD_ADC_Half_First);
+
+	//Transfer Complete
+	if (uEvents & QAD_DMA_Event_Complete)
+		processHalf(QAD_ADC_Half_Second);
+}
+
+
+  //-----------------------
+  //-----------------------
+  //QAD_ADC Control Methods
+
+//QAD_ADC::setHandler
+//QAD_ADC Control Method
+//
+//Used to set a callback delegate to be called each time half of the DMA buffer has been filled
+//pData parameter of the delegate will point to a QAD_ADC_Block structure describing the completed half buffer
+//sHandler - The callback delegate (QAT_Delegate defined in QAT_Delegate.hpp)
+void QAD_ADC::setHandler(const QAT_Delegate& sHandler) {
+	m_sHandler = sHandler;
+}
+
+
+//QAD_ADC::setHandlerFunction
+//QAD_ADC Control Method
+//
+//Used to set a callback function to be called each time half of the DMA buffer has been filled
+//pData parameter of the callback function will point to a QAD_ADC_Block structure describing the completed half buffer
+//pHandler - Pointer to the callback function (QAD_IRQHandler_CallbackFunction defined in setup.hpp)
+void QAD_ADC::setHandlerFunction(QAD_IRQHandler_CallbackFunction pHandler) {
+	m_sHandler = QAT_Delegate::fromCallbackFunction(pHandler);
+}
+
+
+//QAD_ADC::setHandlerClass
+//QAD_ADC Control Method
+//
+//Used to set a callback class to be called each time half of the DMA buffer has been filled
+//pData parameter of the handler() method will point to a QAD_ADC_Block structure describing the completed half buffer
+//pHandler - Pointer to a class inheriting QAD_IRQHandler_CallbackClass (defined in setup.hpp)
+void QAD_ADC::setHandlerClass(QAD_IRQHandler_CallbackClass* pHandler) {
+	m_sHandler = QAT_Delegate::fromCallbackClass(pHandler);
+}
+
+
+//QAD_ADC::start
+//QAD_ADC Control Method
+//
+//Starts sampling
+//The circular DMA transfer and ADC are started before the trigger timer, so that the first scan is stored at the start of the buffer
+void QAD_ADC::start(void) {
+
+	//Check if driver is initialized and is currently not active
+	if ((!m_eInitState) || (m_eState))
+		return;
+
+	//Start circular DMA transfer from ADC data register to sample buffer, with half transfer and transfer complete interrupts
+	HAL_DMA_Start(&m_sDMA, (uint32_t)&m_sHandle.Instance->DR, (uint32_t)m_pBuffer.get(), 2 * m_uBufferScans * m_uChannelCount);
+	__HAL_DMA_ENABLE_IT(&m_sDMA, DMA_IT_HT | DMA_IT_TC);
+	HAL_NVIC_EnableIRQ(QAD_DMAMgr::getIRQ(QAD_DMA1_Channel1));
+
+	//Enable ADC DMA requests and start ADC, which will wait for triggers from the timer
+	SET_BIT(m_sHandle.Instance->CR2, ADC_CR2_DMA);
+	HAL_ADC_Start(&m_sHandle);
+
+	//Enable compare channel if used as the trigger, then enable timer counter
+	switch (QAD_TimerMgr::getADCTrigger(m_eTimer)) {
+		case (QAD_Timer_ADCTrigger_CC1):
+			TIM_CCxChannelCmd(m_sTimerHandle.Instance, TIM_CHANNEL_1, TIM_CCx_ENABLE);
+			break;
+		case (QAD_Timer_ADCTrigger_CC2):
+			TIM_CCxChannelCmd(m_sTimerHandle.Instance, TIM_CHANNEL_2, TIM_CCx_ENABLE);
+			break;
+		default:
+			break;
+	}
+	__HAL_TIM_ENABLE(&m_sTimerHandle);
+
+	//Set driver state to active
+	m_eState = QA_Active;
+}
+
+
+//QAD_ADC::stop
+//QAD_ADC Control Method
+//
+//Stops sampling
+void QAD_ADC::stop(void) {
+
+	//Check if driver is initialized and is currently active
+	if ((!m_eInitState) || (!m_eState))
+		return;
+
+	//Stop trigger timer
+	__HAL_TIM_DISABLE(&m_sTimerHandle);
+	TIM_CCxChannelCmd(m_sTimerHandle.Instance, TIM_CHANNEL_1, TIM_CCx_DISABLE);
+	TIM_CCxChannelCmd(m_sTimerHandle.Instance, TIM_CHANNEL_2, TIM_CCx_DISABLE);
+
+	//Stop ADC and disable ADC DMA requests
+	HAL_ADC_Stop(&m_sHandle);
+	CLEAR_BIT(m_sHandle.Instance->CR2, ADC_CR2_DMA);
+
+	//Stop DMA transfer
+	HAL_NVIC_DisableIRQ(QAD_DMAMgr::getIRQ(QAD_DMA1_Channel1));
+	HAL_DMA_Abort(&m_sDMA);
+
+	//Set driver state to inactive
+	m_eState = QA_Inactive;
+}
+
+
+//QAD_ADC::getValue
+//QAD_ADC Control Method
+//
+//Returns the most recent oversampled/decimated result for a channel in the scan sequence
+//uIndex - The index of the channel within the scan sequence (not the ADC channel number)
+uint16_t QAD_ADC::getValue(uint8_t uIndex) {
+	if (uIndex >= m_uChannelCount)
+		return 0;
+
+	return m_uLatest[uIndex];
+}
+
+
+//QAD_ADC::getTimer
+//QAD_ADC Control Method
+//
+//Returns the timer peripheral being used to trigger scans, or QAD_TimerNone if the driver is not initialized
+QAD_Timer_Periph QAD_ADC::getTimer(void) {
+	if (!m_eInitState)
+		return QAD_TimerNone;
+
+	return m_eTimer;
+}
+
+
+  //--------------------------------------
+  //--------------------------------------
+  //QAD_ADC Private Initialization Methods
+
+//QAD_ADC::periphInit
+//QAD_ADC Private Initialization Method
+//
+//Used to initialize the GPIOs, sample buffers, timer peripheral, ADC peripheral and DMA channel
+//In the case of a failed initialization, a partial deinitialization will be performed to make sure the peripherals and clocks
+//are all in the uninitialized state.
+//Returns QA_OK if successful, or QA_Fail if the configuration is invalid or initialization fails
+QA_Result QAD_ADC::periphInit(void) {
+
+	//Check configuration, including that the whole DMA buffer fits the 16bit DMA transfer count
+	if ((!m_uChannelCount) || (m_uChannelCount > QAD_ADC_CHANNEL_COUNT) || (!m_uPeriod) ||
+			(!m_uBufferScans) || (!m_uOversample) || (m_uBufferScans % m_uOversample) ||
+			((2 * (uint32_t)m_uBufferScans * m_uChannelCount) > 0xFFFF))
+		return QA_Fail;
+
+	//Check that results fit into 16bits after accumulation and shift
+	if (((0xFFFULL * m_uOversample) >> m_uShift) > 0xFFFF)
+		return QA_Fail;
+
+	//Check channels and init GPIOs in analog mode
+	//ADC channels 0 to 7 are PA0 to PA7, and channels 8 and 9 are PB0 and PB1
+	GPIO_InitTypeDef GPIO_Init = {0};
+	GPIO_Init.Mode  = GPIO_MODE_ANALOG;
+	GPIO_Init.Pull  = GPIO_NOPULL;
+	GPIO_Init.Speed = GPIO_SPEED_FREQ_LOW;
+
+	for (uint8_t i=0; i<m_uChannelCount; i++) {
+		uint8_t uCh = m_uChannels[i];
+		if (uCh < 8) {
+			GPIO_Init.Pin = (1 << uCh);
+			HAL_GPIO_Init(GPIOA, &GPIO_Init);
+		} else if (uCh < 10) {
+			GPIO_Init.Pin = (1 << (uCh - 8));
+			HAL_GPIO_Init(GPIOB, &GPIO_Init);
+		} else if ((uCh != 16) && (uCh != 17)) {
+			periphDeinit(DeinitPartial);
+			return QA_Fail;
+		}
+	}
+
+	//Create sample and result buffers
+	m_pBuffer  = std::make_unique<uint16_t[]>(2 * m_uBufferScans * m_uChannelCount);
+	m_pResults = std::make_unique<uint16_t[]>((m_uBufferScans / m_uOversample) * m_uChannelCount);
+
+	//Enable Timer Clock
+	QAD_TimerMgr::enableClock(m_eTimer);
+
+	//Init Timer
+	m_sTimerHandle.Instance                = QAD_TimerMgr::getInstance(m_eTimer);  //Set instance for required timer peripheral
+	m_sTimerHandle.Init.Prescaler          = m_uPrescaler;                         //Set timer prescaler
+	m_sTimerHandle.Init.Period             = m_uPeriod;                            //Set counter period (one scan per period)
+	m_sTimerHandle.Init.CounterMode        = TIM_COUNTERMODE_UP;                   //Set counter mode to up
+	m_sTimerHandle.Init.ClockDivision      = TIM_CLOCKDIVISION_DIV1;               //Unused
+	m_sTimerHandle.Init.RepetitionCounter  = 0x0;                                  //
+	m_sTimerHandle.Init.AutoReloadPreload  = TIM_AUTORELOAD_PRELOAD_ENABLE;        //Enable preload of the timer's auto-reload register
+
+	//Initialize Timer in PWM mode, performing a partial deinitialization if the initialization fails
+	if (HAL_TIM_PWM_Init(&m_sTimerHandle) != HAL_OK) {
+		periphDeinit(DeinitPartial);
+		return QA_Fail;
+	}
+
+	//Configure trigger event
+	//Compare channel triggers use PWM mode 1 so that there is a single rising edge of the reference signal per period
+	//The channel output is enabled in start(), but no GPIO is set to alternate function mode so the pin is unaffected
+	HAL_StatusTypeDef eHALRes = HAL_OK;
+	QAD_Timer_ADCTrigger eTrigger = QAD_TimerMgr::getADCTrigger(m_eTimer);
+	if (eTrigger == QAD_Timer_ADCTrigger_TRGO) {
+		TIM_MasterConfigTypeDef TIM_MasterConfig = {0};
+		TIM_MasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
+		TIM_MasterConfig.MasterSlaveMode     = TIM_MASTERSLAVEMODE_DISABLE;
+		eHALRes = HAL_TIMEx_MasterConfigSynchronization(&m_sTimerHandle, &TIM_MasterConfig);
+	} else {
+		TIM_OC_InitTypeDef TIM_OC_Init = {0};
+		TIM_OC_Init.OCMode       = TIM_OCMODE_PWM1;
+		TIM_OC_Init.Pulse        = (m_uPeriod / 2) + 1;
+		TIM_OC_Init.OCPolarity   = TIM_OCPOLARITY_HIGH;
+		TIM_OC_Init.OCNPolarity  = TIM_OCNPOLARITY_HIGH;
+		TIM_OC_Init.OCFastMode   = TIM_OCFAST_DISABLE;
+		TIM_OC_Init.OCIdleState  = TIM_OCIDLESTATE_RESET;
+		TIM_OC_Init.OCNIdleState = TIM_OCNIDLESTATE_RESET;
+		eHALRes = HAL_TIM_PWM_ConfigChannel(&m_sTimerHandle, &TIM_OC_Init,
+				                                (eTrigger == QAD_Timer_ADCTrigger_CC1) ? TIM_CHANNEL_1 : TIM_CHANNEL_2);
+	}
+	if (eHALRes != HAL_OK) {
+		periphDeinit(DeinitFull);
+		return QA_Fail;
+	}
+
+	//Enable ADC Clock
+	__HAL_RCC_ADC1_CLK_ENABLE();
+
+	//Init ADC
+	m_sHandle.Instance                   = ADC1;                                          //Set instance for ADC1 peripheral
+	m_sHandle.Init.DataAlign             = ADC_DATAALIGN_RIGHT;                           //Right align 12bit results
+	m_sHandle.Init.ScanConvMode          = (m_uChannelCount > 1) ? ADC_SCAN_ENABLE : ADC_SCAN_DISABLE;  //Scan through all ranks on each trigger
+	m_sHandle.Init.ContinuousConvMode    = DISABLE;                                       //One scan per trigger
+	m_sHandle.Init.NbrOfConversion       = m_uChannelCount;                               //Number of ranks in scan sequence
+	m_sHandle.Init.DiscontinuousConvMode = DISABLE;                                       //
+	m_sHandle.Init.NbrOfDiscConversion   = 1;                                             //Unused
+	m_sHandle.Init.ExternalTrigConv      = QAD_TimerMgr::getADCExtSel(m_eTimer);          //Trigger from selected timer
+
+	if (HAL_ADC_Init(&m_sHandle) != HAL_OK) {
+		periphDeinit(DeinitFull);
+		return QA_Fail;
+	}
+
+	//Init ADC Channels
+	//Temperature sensor and internal reference are enabled automatically by HAL_ADC_ConfigChannel() when channels 16 or 17 are used
+	ADC_ChannelConfTypeDef ADC_Channel = {0};
+	for (uint8_t i=0; i<m_uChannelCount; i++) {
+		ADC_Channel.Channel      = m_uChannels[i];
+		ADC_Channel.Rank         = ADC_REGULAR_RANK_1 + i;
+		ADC_Channel.SamplingTime = m_uSampleTime;
+
+		if (HAL_ADC_ConfigChannel(&m_sHandle, &ADC_Channel) != HAL_OK) {
+			periphDeinit(DeinitFull);
+			return QA_Fail;
+		}
+	}
+
+	//Calibrate ADC
+	if (HAL_ADCEx_Calibration_Start(&m_sHandle) != HAL_OK) {
+		periphDeinit(DeinitFull);
+		return QA_Fail;
+	}
+
+	//Init DMA Channel
+	m_sDMA.Instance                 = QAD_DMAMgr::getInstance(QAD_DMA1_Channel1);  //Set instance for DMA channel
+	m_sDMA.Init.Direction           = DMA_PERIPH_TO_MEMORY;                        //Transfer from ADC data register to memory
+	m_sDMA.Init.PeriphInc           = DMA_PINC_DISABLE;                            //ADC data register address is fixed
+	m_sDMA.Init.MemInc              = DMA_MINC_ENABLE;                             //Increment through sample buffer
+	m_sDMA.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;                     //16bit data register
+	m_sDMA.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;                     //16bit sample buffer entries
+	m_sDMA.Init.Mode                = DMA_CIRCULAR;                                //Wrap around sample buffer continuously
+	m_sDMA.Init.Priority            = DMA_PRIORITY_HIGH;                           //
+
+	if (HAL_DMA_Init(&m_sDMA) != HAL_OK) {
+		periphDeinit(DeinitFull);
+		return QA_Fail;
+	}
+
+	//Set DMA IRQ priority. IRQ is enabled in start()
+	HAL_NVIC_SetPriority(QAD_DMAMgr::getIRQ(QAD_DMA1_Channel1), m_uIRQPriority, 0x00);
+
+	//Set Driver States
+	m_eInitState = QA_Initialized; //Set driver state as initialized
+	m_eState     = QA_Inactive;    //Set driver as currently inactive
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_ADC::periphDeinit
+//QAD_ADC Private Initialization Method
+//
+//Used to deinitialize the DMA channel, ADC peripheral, timer peripheral, sample buffers and GPIOs
+//eDeinitMode - Set to DeinitPartial to perform a partial deinitialization (only to be used by periphInit() method
+//              in a case where peripheral initialization has failed
+//            - Set to DeinitFull to perform a full deinitialization in a case where the driver is fully initialized
+void QAD_ADC::periphDeinit(QAD_ADC::DeinitMode eDeinitMode) {
+
+	//Check if a full deinitialization is required
+	if (eDeinitMode) {
+
+		//Deinitialize DMA Channel
+		if (m_sDMA.Instance) {
+			HAL_DMA_DeInit(&m_sDMA);
+			m_sDMA.Instance = NULL;
+		}
+
+		//Deinitialize ADC Peripheral and disable ADC Clock
+		if (m_sHandle.Instance) {
+			HAL_ADC_DeInit(&m_sHandle);
+			m_sHandle.Instance = NULL;
+		}
+		__HAL_RCC_ADC1_CLK_DISABLE();
+
+		//Deinitialize Timer Peripheral
+		HAL_TIM_PWM_DeInit(&m_sTimerHandle);
+	}
+
+	//Disable Timer Clock
+	if (m_pBuffer)
+		QAD_TimerMgr::disableClock(m_eTimer);
+
+	//Release sample and result buffers
+	m_pBuffer.reset();
+	m_pResults.reset();
+
+	//Deinitialize GPIOs
+	for (uint8_t i=0; (i<m_uChannelCount) && (i<QAD_ADC_CHANNEL_COUNT); i++) {
+		uint8_t uCh = m_uChannels[i];
+		if (uCh < 8)
+			HAL_GPIO_DeInit(GPIOA, (1 << uCh));
+		else if (uCh < 10)
+			HAL_GPIO_DeInit(GPIOB, (1 << (uCh - 8)));
+	}
+
+	//Set Driver States
+	m_eState     = QA_Inactive;        //Set driver as currently inactive
+	m_eInitState = QA_NotInitialized;  //Set driver state as not initialized
+}
+
+
+  //----------------------------------
+  //----------------------------------
+  //QAD_ADC Private Processing Methods
+
+//QAD_ADC::processHalf
+//QAD_ADC Private Processing Method
+//
+//Oversamples and decimates a completed half of the DMA buffer into the results buffer, updates the latest result for each channel and
+//then calls the handler callback delegate
+//eHalf - The half of the DMA buffer that has been completed. Member of QAD_ADC_Half
+void QAD_ADC::processHalf(QAD_ADC_Half eHalf) {
+	uint8_t         uChannels = m_uChannelCount;
+	const uint16_t* pSamples  = m_pBuffer.get() + (eHalf * m_uBufferScans * uChannels);
+	uint16_t*       pResults  = m_pResults.get();
+	uint16_t        uResults  = m_uBufferScans / m_uOversample;
+
+	//Accumulate each block of m_uOversample scans into a single result scan
+	const uint16_t* pIn  = pSamples;
+	uint16_t*       pOut = pResults;
+	for (uint16_t r=0; r<uResults; r++) {
+		uint32_t uAccum[QAD_ADC_CHANNEL_COUNT] = {0};
+
+		for (uint16_t s=0; s<m_uOversample; s++) {
+			for (uint8_t c=0; c<uChannels; c++)
+				uAccum[c] += *pIn++;
+		}
+
+		for (uint8_t c=0; c<uChannels; c++)
+			*pOut++ = (uint16_t)(uAccum[c] >> m_uShift);
+	}
+
+	//Update latest results
+	pOut -= uChannels;
+	for (uint8_t c=0; c<uChannels; c++)
+		m_uLatest[c] = pOut[c];
+
+	//Call handler callback
+	QAD_ADC_Block sBlock;
+	sBlock.eHalf     = eHalf;
+	sBlock.pSamples  = pSamples;
+	sBlock.uScans    = m_uBufferScans;
+	sBlock.pResults  = pResults;
+	sBlock.uResults  = uResults;
+	sBlock.uChannels = uChannels;
+
+	m_sHandler(&sBlock);
+}
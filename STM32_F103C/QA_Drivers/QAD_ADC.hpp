@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: ADC Driver                                                      */
+/*   Filename: QAD_ADC.hpp                                                 */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_ADC_HPP_
+#define __QAD_ADC_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include <memory>
+
+#include "QAD_TimerMgr.hpp"
+#include "QAD_DMAMgr.hpp"
+#include "QAT_Delegate.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------------------
+//QAD_ADC_CHANNEL_COUNT
+//
+//Used to define the maximum number of channels that can be included in the QAD_ADC driver's scan sequence
+#define QAD_ADC_CHANNEL_COUNT   16
+
+
+//------------
+//QAD_ADC_Half
+//
+//Used to indicate which half of the DMA buffer has been completed when the half/full buffer callback is called
+enum QAD_ADC_Half : uint8_t {
+	QAD_ADC_Half_First = 0,  //First half of the DMA buffer has been filled (DMA half transfer)
+	QAD_ADC_Half_Second      //Second half of the DMA buffer has been filled (DMA transfer complete)
+};
+
+
+//-------------
+//QAD_ADC_Block
+//
+//Structure passed as the pData parameter of the handler callback each time half of the DMA buffer has been filled
+//The data pointed to is only valid until the following half of the DMA buffer has been filled, so should be processed or copied within the callback
+typedef struct {
+
+	QAD_ADC_Half    eHalf;       //Which half of the DMA buffer has been completed. Member of QAD_ADC_Half
+
+	const uint16_t* pSamples;    //Pointer to the raw samples in the completed half of the DMA buffer, stored as interleaved scans
+	uint16_t        uScans;      //Number of scans in pSamples
+
+	const uint16_t* pResults;    //Pointer to the oversampled/decimated results produced from the completed half of the DMA buffer,
+	                             //stored as interleaved scans
+	uint16_t        uResults;    //Number of oversampled/decimated scans in pResults
+
+	uint8_t         uChannels;   //Number of channels in each scan
+
+} QAD_ADC_Block;
+
+
+//------------------
+//QAD_ADC_InitStruct
+//
+//This structure is used to be able to create the QAD_ADC driver class
+typedef struct {
+
+	QAD_Timer_Periph eTimer;          //Timer peripheral to be used to trigger scans. Member of QAD_Timer_Periph as defined in QAD_TimerMgr.hpp
+	                                  //Set to QAD_TimerNone to have an available timer allocated using QAD_TimerMgr::findTimerADC()
+
+	uint32_t         uPrescaler;      //Prescaler to be used for the trigger timer
+	uint32_t         uPeriod;         //Counter period to be used for the trigger timer. One scan is triggered per timer period
+
+	uint8_t          uChannelCount;   //Number of channels in the scan sequence (between 1 and QAD_ADC_CHANNEL_COUNT)
+	uint8_t          uChannels[QAD_ADC_CHANNEL_COUNT];  //ADC channel numbers in scan order (0 to 9 for PA0-PA7 and PB0-PB1, 16 for the
+	                                                    //temperature sensor, 17 for the internal reference)
+	uint32_t         uSampleTime;     //Sample time to be used for all channels (ADC_SAMPLETIME define from stm32f1xx_hal_adc.h)
+	                                  //The conversion time of a full scan must be shorter than the trigger timer period
+
+	uint16_t         uBufferScans;    //Number of scans stored in each half of the circular DMA buffer
+	                                  //2 * uBufferScans * uChannelCount must not exceed 65535, as the DMA transfer count is 16bits
+
+	uint16_t         uOversample;     //Number of scans to be accumulated into each result (1 for no oversampling)
+	                                  //Must divide evenly into uBufferScans
+	uint8_t          uShift;          //Number of bits the accumulated result is shifted right by to produce the final result
+	                                  //For example, an oversample ratio of 16 and shift of 2 produces 14bit results
+
+	uint8_t          uIRQPriority;    //IRQ Priority for the DMA half/full transfer interrupt (a value between 0 and 15)
+
+} QAD_ADC_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//-------
+//QAD_ADC
+//
+//Driver class used for timer triggered multi-channel sampling using ADC1
+//
+//A trigger timer starts a scan of the selected channels once per timer period, and each conversion result is transferred by DMA into a
+//circular buffer, so no CPU time is used for sampling. The DMA half transfer and transfer complete interrupts are used to oversample and
+//decimate each completed half of the buffer, and to call the handler callback delegate with a QAD_ADC_Block structure describing it.
+//
+//The F1 series ADC has no hardware oversampling, so oversampling and decimation are performed in software on each completed half buffer.
+//
+//Uses DMA1 channel 1, which is claimed through QAD_DMAMgr. This also prevents more than one instance of the driver being initialized.
+//The handler() method is to be called by DMA1_Channel1_IRQHandler() within handlers.cpp
+class QAD_ADC {
+private:
+
+	//Deinitialization mode to be used by periphDeinit() method
+  enum DeinitMode : uint8_t {
+  	DeinitPartial = 0,    //Only to be used for partial deinitialization upon initialization failure in periphInit() method
+  	DeinitFull            //Used for full driver deinitialization when driver is in a fully initialized state
+  };
+
+  QA_InitState       m_eInitState;     //Stores whether the driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+  QA_ActiveState     m_eState;         //Stores whether the driver is currently active. Member of QA_ActiveState enum defined in setup.hpp
+
+  QAD_Timer_Periph   m_eTimerSelect;   //Stores the timer peripheral requested in the initialization structure
+  QAD_Timer_Periph   m_eTimer;         //Stores the timer peripheral being used by the driver
+
+  ADC_HandleTypeDef  m_sHandle;        //Handle used by HAL functions to access ADC peripheral (defined in stm32f1xx_hal_adc.h)
+  TIM_HandleTypeDef  m_sTimerHandle;   //Handle used by HAL functions to access Timer peripheral (defined in stm32f1xx_hal_tim.h)
+  DMA_HandleTypeDef  m_sDMA;           //Handle used by HAL functions to access DMA channel (defined in stm32f1xx_hal_dma.h)
+
+  uint32_t           m_uPrescaler;     //Prescaler to be used for the trigger timer
+  uint32_t           m_uPeriod;        //Counter period to be used for the trigger timer
+
+  uint8_t            m_uChannelCount;  //Number of channels in the scan sequence
+  uint8_t            m_uChannels[QAD_ADC_CHANNEL_COUNT];  //ADC channel numbers in scan order
+  uint32_t           m_uSampleTime;    //Sample time to be used for all channels
+
+  uint16_t           m_uBufferScans;   //Number of scans in each half of the DMA buffer
+  uint16_t           m_uOversample;    //Number of scans accumulated into each result
+  uint8_t            m_uShift;         //Number of bits each accumulated result is shifted right by
+
+  uint8_t            m_uIRQPriority;   //IRQ Priority for the DMA interrupt
+
+  std::unique_ptr<uint16_t[]> m_pBuffer;   //Circular DMA buffer of raw samples
+  std::unique_ptr<uint16_t[]> m_pResults;  //Buffer of oversampled/decimated results for the most recently completed half buffer
+
+  volatile uint16_t  m_uLatest[QAD_ADC_CHANNEL_COUNT];  //Most recent oversampled/decimated result for each channel
+
+  QAT_Delegate       m_sHandler;       //Callback delegate to be called when half of the DMA buffer has been filled (QAT_Delegate defined in QAT_Delegate.hpp)
+
+public:
+
+  //--------------------------
+	//Constructors / Destructors
+
+  QAD_ADC() = delete;                   //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+  QAD_ADC(QAD_ADC_InitStruct& sInit) :  //The class constructor to be used, which has a reference to an initialization structure passed to it
+  	m_eInitState(QA_NotInitialized),
+		m_eState(QA_Inactive),
+		m_eTimerSelect(sInit.eTimer),
+		m_eTimer(QAD_TimerNone),
+		m_sHandle({0}),
+		m_sTimerHandle({0}),
+		m_sDMA({0}),
+		m_uPrescaler(sInit.uPrescaler),
+		m_uPeriod(sInit.uPeriod),
+		m_uChannelCount(sInit.uChannelCount),
+		m_uSampleTime(sInit.uSampleTime),
+		m_uBufferScans(sInit.uBufferScans),
+		m_uOversample(sInit.uOversample),
+		m_uShift(sInit.uShift),
+		m_uIRQPriority(sInit.uIRQPriority),
+		m_pBuffer(nullptr),
+		m_pResults(nullptr),
+		m_sHandler() {
+
+  	//Copy channel sequence and clear latest results
+  	for (uint8_t i=0; i<QAD_ADC_CHANNEL_COUNT; i++) {
+  		m_uChannels[i] = sInit.uChannels[i];
+  		m_uLatest[i]   = 0;
+  	}
+  }
+
+  ~QAD_ADC() {        //Destructor to make sure peripheral is made inactive and deinitialized upon class destruction
+
+  	//Stop ADC driver if currently active
+  	if (m_eState)
+  		stop();
+
+  	//Deinitialize ADC driver if currently initialized
+  	if (m_eInitState)
+  		deinit();
+  }
+
+
+  //NOTE: See QAD_ADC.cpp for details of the following functions
+
+  //----------------------
+  //Initialization Methods
+
+  QA_Result init(void);
+  void deinit(void);
+
+
+  //-------------------
+  //IRQ Handler Methods
+
+  void handler(void);
+
+
+  //---------------
+  //Control Methods
+
+  void setHandler(const QAT_Delegate& sHandler);
+  void setHandlerFunction(QAD_IRQHandler_CallbackFunction pHandler);
+  void setHandlerClass(QAD_IRQHandler_CallbackClass* pHandler);
+
+  void start(void);
+  void stop(void);
+
+  uint16_t getValue(uint8_t uIndex);
+  QAD_Timer_Periph getTimer(void);
+
+private:
+
+  //----------------------
+  //Initialization Methods
+
+  QA_Result periphInit(void);
+  void periphDeinit(DeinitMode eDeinitMode);
+
+
+  //------------------
+  //Processing Methods
+
+  void processHalf(QAD_ADC_Half eHalf);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_ADC_HPP_ */
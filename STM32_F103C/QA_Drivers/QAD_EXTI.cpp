@@ -18,6 +18,8 @@
 //Includes
 #include "QAD_EXTI.hpp"
 
+#include "QAD_Timestamp.hpp"
+
 
 	//------------------------------------------
 	//------------------------------------------
@@ -38,8 +40,9 @@ QAD_EXTI::QAD_EXTI(GPIO_TypeDef* pGPIO, uint16_t uPin) :
   QAD_GPIO_Input(pGPIO, uPin),            //Initialize the inherited QAD_GPIO_Input driver class
 	m_eEXTIState(QA_Inactive),              //Initialize the EXTI mode in disabled state
 	m_eEdgeType(QAD_EXTI_EdgeType_Rising),  //Initialize the edge type in rising mode
-	m_pHandlerFunction(NULL),               //Initialize handler function pointer as NULL
-	m_pHandlerClass(NULL) {                 //Initialize handler class pointer as NULL
+	m_uLine(QAD_EXTIMgr::getLine(uPin)),    //Find the external interrupt line of the pin
+	m_eCapture(QA_Inactive),                //Initialize with capture mode disabled
+	m_sHandler() {                          //Initialize handler delegate as unbound
 
 }
 
@@ -56,8 +59,9 @@ QAD_EXTI::QAD_EXTI(GPIO_TypeDef* pGPIO, uint16_t uPin, QAD_GPIO_PullMode ePull,
 		QAD_GPIO_Input(pGPIO, uPin, ePull), //Initialize the inherited QAD_GPIO_Input driver class
 		m_eEXTIState(QA_Inactive),          //Initialize the EXTI mode in disabled state
 		m_eEdgeType(eEdgeType),             //Initialize the edge type as specified by eEdgeType
-		m_pHandlerFunction(NULL),           //Initialize handler function pointer as NULL
-		m_pHandlerClass(NULL) {             //Initialize handler class pointer as NULL
+		m_uLine(QAD_EXTIMgr::getLine(uPin)),//Find the external interrupt line of the pin
+		m_eCapture(QA_Inactive),            //Initialize with capture mode disabled
+		m_sHandler() {                      //Initialize handler delegate as unbound
 
 }
 
@@ -83,23 +87,13 @@ QAD_EXTI::~QAD_EXTI() {
 //QAD_EXTI::handler
 //QAD_EXTI Handler Method
 //
-//This method is to be called by the interrupt handler function from handlers.cpp
+//This method is called by QAD_EXTIMgr::dispatch() from the interrupt handler functions in handlers.cpp when the pin's line is triggered
+//The line's pending flag has already been cleared by the manager
 void QAD_EXTI::handler(void) {
 
-	//Check if required pin interrupt has been triggered
-  if (__HAL_GPIO_EXTI_GET_IT(m_uPin) != RESET) {
-
-  	//Call interrupt handler callback function if one has been assigned
-  	if (m_pHandlerFunction)
-  		m_pHandlerFunction(NULL);
-
-  	//Call handler method of interrupt handler callback class if one has been assigned
-  	if (m_pHandlerClass)
-  		m_pHandlerClass->handler(NULL);
-
-  	//Clear pin interrupt
-  	__HAL_GPIO_EXTI_CLEAR_IT(m_uPin);
-  }
+	//Call interrupt handler callback delegate, passing a pointer to this driver as the event data
+	//An unbound delegate calls an empty stub, so no check is required
+	m_sHandler(this);
 }
 
 
@@ -107,23 +101,34 @@ void QAD_EXTI::handler(void) {
   //------------------------
   //QAD_EXTI Control Methods
 
+//QAD_EXTI::setHandler
+//QAD_EXTI Control Method
+//
+//Used to set the interrupt handler callback delegate.
+//The delegate's event data (pData) is a pointer to this QAD_EXTI driver
+//sHandler - The callback delegate. The type is defined in QAT_Delegate.hpp
+void QAD_EXTI::setHandler(const QAT_Delegate& sHandler) {
+	m_sHandler = sHandler;
+}
+
+
 //QAD_EXTI::setHandlerFunction
 //QAD_EXTI Control Method
 //
-//Used to set the pointer to the interrupt handler callback function.
+//Used to set the pointer to the interrupt handler callback function. Replaces any previously set handler callback.
 //pHandler - A pointer to the handler callback function. The type is defined in setup.hpp
 void QAD_EXTI::setHandlerFunction(QAD_IRQHandler_CallbackFunction pHandler) {
-  m_pHandlerFunction = pHandler;
+  m_sHandler = QAT_Delegate::fromCallbackFunction(pHandler);
 }
 
 
 //QAD_EXTI::setHandlerClass
 //QAD_EXTI Control Method
 //
-//Used to set the pointer to the interrupt handler callback class.
+//Used to set the pointer to the interrupt handler callback class. Replaces any previously set handler callback.
 //pHandler - A pointer to the handler callback class. The type is defined in setup.hpp
 void QAD_EXTI::setHandlerClass(QAD_IRQHandler_CallbackClass* pHandler) {
-  m_pHandlerClass = pHandler;
+  m_sHandler = QAT_Delegate::fromCallbackClass(pHandler);
 }
 
 
@@ -131,7 +136,17 @@ void QAD_EXTI::setHandlerClass(QAD_IRQHandler_CallbackClass* pHandler) {
 //QAD_EXTI Control Method
 //
 //Used to enable external interrupt for the required GPIO pin
-void QAD_EXTI::enable(void) {
+//Returns QA_OK if successful, or QA_Error_PeriphBusy if the pin's line is already in use by another QAD_EXTI driver
+//(the same pin number on a different GPIO port)
+QA_Result QAD_EXTI::enable(void) {
+
+  //Register line with external interrupt manager, which also enables the line's IRQ
+  QA_Result eRes = QAD_EXTIMgr::registerLine(m_uLine, this, m_pGPIO);
+  if (eRes)
+  	return eRes;
+
+  //Restore capture mode, which is cleared when the line is deregistered
+  QAD_EXTIMgr::setCapture(m_uLine, m_eCapture);
 
   //Setup GPIO
   GPIO_InitTypeDef GPIO_Init = {0};
@@ -151,37 +166,9 @@ void QAD_EXTI::enable(void) {
   }
   HAL_GPIO_Init(m_pGPIO, &GPIO_Init);
 
-  //Setup Interrupt
-  switch (m_uPin) {
-    case (GPIO_PIN_0):
-    	m_eIRQ = EXTI0_IRQn;
-      break;
-    case (GPIO_PIN_1):
-    	m_eIRQ = EXTI1_IRQn;
-      break;
-    case (GPIO_PIN_2):
-    	m_eIRQ = EXTI2_IRQn;
-      break;
-    case (GPIO_PIN_3):
-    	m_eIRQ = EXTI3_IRQn;
-      break;
-    case (GPIO_PIN_4):
-    	m_eIRQ = EXTI4_IRQn;
-      break;
-    default:
-    	if ((m_uPin >= GPIO_PIN_5) && (m_uPin <= GPIO_PIN_9)) {
-    		m_eIRQ = EXTI9_5_IRQn;
-    	} else if ((m_uPin >= GPIO_PIN_10) && (m_uPin <= GPIO_PIN_15)) {
-    		m_eIRQ = EXTI15_10_IRQn;
-    	}
-  }
-
-  //Set external interrupt priority. QAD_IRQPRIORITY_EXTI is defined in setup.hpp
-  HAL_NVIC_SetPriority(m_eIRQ, QAD_IRQPRIORITY_EXTI, 0);
-  HAL_NVIC_EnableIRQ(m_eIRQ);
-
   //Set State
   m_eEXTIState = QA_Active;
+  return QA_OK;
 }
 
 
@@ -189,12 +176,17 @@ void QAD_EXTI::enable(void) {
 //QAD_EXTI Control Method
 //
 //Disable external interrupt mode for the required pin, which places the pin back into standard GPIO input mode
+//The line is masked rather than its IRQ being disabled, as the IRQ may be shared with other lines
 void QAD_EXTI::disable(void) {
   if (!m_eEXTIState)
   	return;
 
-  //Disable IRQ
-  HAL_NVIC_DisableIRQ(m_eIRQ);
+  //Mask line and clear any pending interrupt
+  CLEAR_BIT(EXTI->IMR, (uint32_t)m_uPin);
+  EXTI->PR = m_uPin;
+
+  //Deregister line from external interrupt manager, which disables the IRQ if no other lines are using it
+  QAD_EXTIMgr::deregisterLine(m_uLine, this);
 
   //Set GPIO back to normal input
   GPIO_InitTypeDef GPIO_Init = {0};
@@ -209,6 +201,40 @@ void QAD_EXTI::disable(void) {
 }
 
 
+//QAD_EXTI::setCapture
+//QAD_EXTI Control Method
+//
+//Used to enable or disable capture mode, in which each edge is recorded with a cycle count timestamp into the QAD_EXTIMgr capture queue
+//rather than calling the handler callback. QAD_Timestamp is initialized if not already initialized, as it provides the timestamps
+//eCapture - Set to QA_Active to enable capture mode, or QA_Inactive to disable it
+//Returns QA_OK if successful, or an error if QAD_Timestamp initialization fails
+QA_Result QAD_EXTI::setCapture(QA_ActiveState eCapture) {
+
+	//Initialize cycle counter if required
+	if ((eCapture) && (!QAD_Timestamp::getInitState())) {
+		QA_Result eRes = QAD_Timestamp::init();
+		if (eRes)
+			return eRes;
+	}
+
+	//Store capture mode, and apply it to the line if external interrupt is currently enabled
+	m_eCapture = eCapture;
+	if (m_eEXTIState)
+		QAD_EXTIMgr::setCapture(m_uLine, m_eCapture);
+
+	return QA_OK;
+}
+
+
+//QAD_EXTI::getCapture
+//QAD_EXTI Control Method
+//
+//Returns QA_Active if capture mode is enabled, or QA_Inactive if not
+QA_ActiveState QAD_EXTI::getCapture(void) {
+	return m_eCapture;
+}
+
+
 //QAD_EXTI::setPullMode
 //QAD_EXTI Control Method
 //
@@ -23,6 +23,8 @@
 #include "setup.hpp"
 
 #include "QAD_GPIO.hpp"
+#include "QAD_EXTIMgr.hpp"
+#include "QAT_Delegate.hpp"
 
 
 	//------------------------------------------
@@ -47,6 +49,10 @@ enum QAD_EXTI_EdgeType : uint8_t {
 //Driver to allow use of a GPIO pin to trigger external interrupts.
 //Inherits from QAD_GPIO_Input driver class to allow driver to dynamically switch between being used as a standard GPIO input pin,
 //or to be used to trigger external interrupt.
+//The driver registers its line with QAD_EXTIMgr when enabled, which owns the external interrupt IRQs and calls handler() for each
+//triggered line, so no IRQ handler function needs to be written for the driver.
+//In capture mode each edge is instead recorded with a cycle count timestamp into the QAD_EXTIMgr capture queue, and the handler callback
+//is not called. Events from all lines in capture mode are then read in batches using QAD_EXTIMgr::readEvents()
 class QAD_EXTI : public QAD_GPIO_Input {
 private:
 
@@ -56,13 +62,11 @@ private:
 	QAD_EXTI_EdgeType m_eEdgeType;   //Stores whether the external interrupt trigges on rising edge, falling edge, or both edges.
 	                                 //A member of the QAD_EXTI_EdgeType enum
 
-	IRQn_Type         m_eIRQ;        //Stores the IRQ handler to be triggered. A member of IRQn_Type as defined in stm32f411xe.h
+	uint8_t           m_uLine;       //Stores the external interrupt line of the GPIO pin
+	QA_ActiveState    m_eCapture;    //Stores whether edges are recorded into the QAD_EXTIMgr capture queue (QA_Active)
+	                                 //or routed to the handler callback (QA_Inactive)
 
-  QAD_IRQHandler_CallbackFunction m_pHandlerFunction;  //Pointer to the interrupt handler function to be called when interrupt is triggered
-                                                       //Callback function pointer as defined in setup.hpp
-
-  QAD_IRQHandler_CallbackClass*   m_pHandlerClass;     //Pointer to the interrupt handler class to be called when interrupt is triggered
-                                                       //Callback class as defined in setup.hpp
+  QAT_Delegate      m_sHandler;    //Callback delegate to be called when interrupt is triggered (QAT_Delegate defined in QAT_Delegate.hpp)
 
 public:
 
@@ -88,12 +92,16 @@ public:
   //---------------
   //Control Methods
 
+  void setHandler(const QAT_Delegate& sHandler);
   void setHandlerFunction(QAD_IRQHandler_CallbackFunction pHandler);
   void setHandlerClass(QAD_IRQHandler_CallbackClass* pHandler);
 
-  void enable(void);
+  QA_Result enable(void);
   void disable(void);
 
+  QA_Result setCapture(QA_ActiveState eCapture);
+  QA_ActiveState getCapture(void);
+
   void setPullMode(QAD_GPIO_PullMode ePull) override;
 
 };
@@ -23,6 +23,44 @@
 	//------------------------------------------
 	//------------------------------------------
 
+//Definition of default acceleration curve, required as its address is taken by the constructor and setCurve()
+constexpr QAD_Encoder_Curve QAD_Encoder::m_sDefaultCurve;
+
+
+  //------------------------------
+  //------------------------------
+  //QAD_Encoder_Curve Tool Methods
+
+//QAD_Encoder_Curve::apply
+//QAD_Encoder_Curve Tool Method
+//
+//Returns a number of clicks scaled by the curve's gain for a rotation speed, as used by QAD_EncoderMode_Curve of the encoder drivers
+//The fractional part of the scaled value is carried to the next call, so gains that are not whole numbers are followed exactly over time.
+//The carried fraction is discarded when the direction of rotation changes
+//iClicks - The number of clicks since the previous call
+//uAccel  - The rotation speed in counts per second, as measured by the driver's update() method
+//iFrac   - The fractional part carried between calls, which is owned by the calling driver
+int16_t QAD_Encoder_Curve::apply(int16_t iClicks, uint16_t uAccel, int16_t& iFrac) const {
+	if (!iClicks)
+		return 0;
+
+	//Look up gain for current speed
+	uint32_t uEntry = uAccel / ((uStep) ? uStep : 1);
+	if (uEntry >= QAD_ENCODER_CURVE_SIZE)
+		uEntry = QAD_ENCODER_CURVE_SIZE - 1;
+
+	//Discard carried fraction on change of direction
+	if ((iClicks < 0) != (iFrac < 0))
+		iFrac = 0;
+
+	//Scale clicks by gain, splitting the result into whole and fractional parts
+	int32_t iScaled = ((int32_t)iClicks * uGain[uEntry]) + iFrac;
+	int32_t iOut    = iScaled / (1 << QAD_ENCODER_CURVE_FRACBITS);
+	iFrac           = (int16_t)(iScaled - (iOut * (1 << QAD_ENCODER_CURVE_FRACBITS)));
+
+	return (iOut > INT16_MAX) ? INT16_MAX : ((iOut < -INT16_MAX) ? -INT16_MAX : (int16_t)iOut);
+}
+
 
   //----------------------------------
   //----------------------------------
@@ -44,6 +82,23 @@ QA_Result QAD_Encoder::init(void) {
   if (QAD_TimerMgr::getState(m_eTimer))
   	return QA_Error_PeriphBusy;
 
+  //Index detection requires extended position mode, and capture mode requires channel 3 of the selected timer
+  if (m_eIndexMode) {
+  	if (!m_eExtended)
+  		return QA_Fail;
+  	if ((m_eIndexMode == QAD_Encoder_IndexCapture) && (QAD_TimerMgr::getChannels(m_eTimer) < 3))
+  		return QA_Error_PeriphNotSupported;
+  	if ((m_eIndexMode == QAD_Encoder_IndexEXTI) && (QAD_EXTIMgr::getDriver(QAD_EXTIMgr::getLine(m_uIdx_Pin))))
+  		return QA_Error_PeriphBusy;
+  }
+
+  //Velocity estimation requires the cycle counter, so initialize QAD_Timestamp if not already initialized
+  if ((m_eVelocity) && (!QAD_Timestamp::getInitState())) {
+  	QA_Result eRes = QAD_Timestamp::init();
+  	if (eRes)
+  		return eRes;
+  }
+
   //Register Timer peripheral as now being in use
   QAD_TimerMgr::registerTimer(m_eTimer, QAD_Timer_InUse_Encoder);
 
@@ -77,6 +132,44 @@ void QAD_Encoder::deinit(void) {
 }
 
 
+  //-------------------------------
+  //-------------------------------
+  //QAD_Encoder IRQ Handler Methods
+
+//QAD_Encoder::handler
+//QAD_Encoder IRQ Handler Method
+//
+//This method is only to be called by the interrupt request handler function of the selected timer from handlers.cpp
+//Interrupt flags are only processed if their interrupt is enabled, as the flags are set by the hardware regardless
+//On each counter wrap in extended position mode the wrap count is updated, with the direction being found from the counter value
+//On each captured edge the captured counter value and the current cycle count are stored for use by sampleVelocity()
+//On each index captured by channel 3 the captured counter value is passed to processIndex()
+void QAD_Encoder::handler(void) {
+	TIM_TypeDef* pTimer = m_sHandle.Instance;
+
+	//Check for counter wrap
+	if ((pTimer->SR & TIM_SR_UIF) && (pTimer->DIER & TIM_DIER_UIE)) {
+		pTimer->SR = ~TIM_SR_UIF;
+		m_iWraps  += (pTimer->CNT < 0x8000) ? 1 : -1;
+	}
+
+	//Check for encoder edge captured by channel 1. Reading the capture register clears the capture flag
+	if ((pTimer->SR & TIM_SR_CC1IF) && (pTimer->DIER & TIM_DIER_CC1IE)) {
+		m_uEdgeCount = (uint16_t)pTimer->CCR1;
+		m_uEdgeTime  = QAD_Timestamp::getCycles();
+		m_uEdgeSeq++;
+		pTimer->SR   = ~TIM_SR_CC1OF;
+	}
+
+	//Check for index captured by channel 3. Reading the capture register clears the capture flag
+	if ((pTimer->SR & TIM_SR_CC3IF) && (pTimer->DIER & TIM_DIER_CC3IE)) {
+		uint16_t uLatched = (uint16_t)pTimer->CCR3;
+		pTimer->SR = ~TIM_SR_CC3OF;
+		processIndex(uLatched);
+	}
+}
+
+
   //---------------------------
   //---------------------------
   //QAD_Encoder Control Methods
@@ -85,10 +178,18 @@ void QAD_Encoder::deinit(void) {
 //QAD_Encoder Control Method
 //
 //This method is used to start the timer peripheral in encoder mode
-void QAD_Encoder::start(void) {
+//Returns QA_OK if successful, or if the driver is already active
+//        QA_Fail if the driver is not initialized
+//        QA_Error_PeriphBusy if the index signal's external interrupt line has been claimed by another driver, in which case the driver
+//        is left inactive
+QA_Result QAD_Encoder::start(void) {
+
+	//Check encoder driver is initialized
+	if (!m_eInitState)
+		return QA_Fail;
 
-	//Check encoder driver is initialized and is not currently active
-  if ((m_eInitState) && (!m_eState)) {
+	//Check encoder driver is not currently active
+  if (!m_eState) {
 
   	//Clear encoder/counter data
   	clearData();
@@ -96,9 +197,43 @@ void QAD_Encoder::start(void) {
   	//Start Timer peripheral in encoder mode
   	HAL_TIM_Encoder_Start(&m_sHandle, TIM_CHANNEL_ALL);
 
+  	//Enable counter wrap interrupt in extended position mode
+  	if (m_eExtended) {
+  		m_sHandle.Instance->SR    = ~TIM_SR_UIF;
+  		m_sHandle.Instance->DIER |= TIM_DIER_UIE;
+  	}
+
+  	//Reset velocity estimation and enable edge timing
+  	if (m_eVelocity) {
+  		m_iVelocity    = 0;
+  		m_uSampleCount = 0;
+  		m_uSampleTime  = QAD_Timestamp::getCycles();
+  		setEdgeTiming(true);
+  	}
+
+  	//Clear index data and enable index detection
+  	resetIndex();
+  	if (m_eIndexMode == QAD_Encoder_IndexCapture) {
+  		m_sHandle.Instance->SR    = ~(TIM_SR_CC3IF | TIM_SR_CC3OF);
+  		m_sHandle.Instance->DIER |= TIM_DIER_CC3IE;
+  	}
+
   	//Set driver state to active
   	m_eState = QA_Active;
+
+  	//Enable index external interrupt, which claims its line. If the line is in use by another driver then stop() is used to undo
+  	//the partial start
+  	if (m_eIndexMode == QAD_Encoder_IndexEXTI) {
+  		QA_Result eRes = m_pIndexEXTI->enable();
+  		if (eRes) {
+  			stop();
+  			return eRes;
+  		}
+  	}
   }
+
+  //Return
+  return QA_OK;
 }
 
 
@@ -111,8 +246,18 @@ void QAD_Encoder::stop(void) {
 	//Check encoder driver is initialized and is currently active
   if ((m_eInitState) && (m_eState)) {
 
-  	//Stop Timer peripheral
+  	//Disable index detection
+  	if (m_eIndexMode == QAD_Encoder_IndexCapture)
+  		m_sHandle.Instance->DIER &= ~TIM_DIER_CC3IE;
+  	else if (m_eIndexMode == QAD_Encoder_IndexEXTI)
+  		m_pIndexEXTI->disable();
+
+  	//Disable counter wrap interrupt and edge timing, and stop Timer peripheral
+  	m_sHandle.Instance->DIER &= ~TIM_DIER_UIE;
+  	if (m_eVelocity)
+  		setEdgeTiming(false);
   	HAL_TIM_Encoder_Stop(&m_sHandle, TIM_CHANNEL_ALL);
+  	m_iVelocity = 0;
 
   	//Set driver state to inactive
   	m_eState = QA_Inactive;
@@ -128,7 +273,8 @@ void QAD_Encoder::stop(void) {
 //the most recent encoder value.
 //
 //uTicks - The time (in milliseconds) that has passed since this method was last called
-//         This is used to be able to calculate the encoder acceleration value
+//         This is used to be able to calculate the encoder acceleration value, with a value of 0 being treated as 1
+//         For an accurate speed measurement use sampleVelocity() and getVelocity() instead
 void QAD_Encoder::update(uint32_t uTicks) {
 
 	//Check that encoder driver is active
@@ -137,23 +283,16 @@ void QAD_Encoder::update(uint32_t uTicks) {
 		m_uValueOld = m_uValueNew;                        //Store previous current value into old value
 		m_uValueNew = __HAL_TIM_GET_COUNTER(&m_sHandle);  //Update current value from Timer's counter register
 
-		//The following code is used to determine if the encoder has been moved in a clockwise or counter-clockwise rotation,
-		//while also taking into account whether the counter register value has wrapped around
-		uint16_t uDiffA;
-		uint16_t uDiffB;
-		bool bValComp = (m_uValueNew < m_uValueOld);
-		if (bValComp) {
-			uDiffA = m_uValueOld - m_uValueNew;
-			uDiffB = m_uValueNew + (m_uMaxVal - m_uValueOld);
-		} else {
-			uDiffA = m_uValueNew - m_uValueOld;
-			uDiffB = m_uValueOld + (m_uMaxVal - m_uValueNew);
-		}
-		uint16_t uDiff = (uDiffA < uDiffB) ? uDiffA : uDiffB;
-		m_iValue += (bValComp ? 0-uDiff : uDiff);
+		//Determine if the encoder has been moved in a clockwise or counter-clockwise rotation, while also taking into account
+		//whether the counter register value has wrapped around
+		int32_t  iDiff = getCountDiff(m_uValueNew, m_uValueOld);
+		uint32_t uDiff = (uint32_t)((iDiff < 0) ? -iDiff : iDiff);
+		m_iValue += (int16_t)iDiff;
 
-		//Calculate encoder acceleration value
-		m_uAccel = uDiff * 1000 / uTicks;
+		//Calculate encoder acceleration value, avoiding division by zero when called more than once per millisecond
+		//The value is limited to 16bits rather than wrapping, so that fast rotation selects the highest entries of the acceleration curve
+		uint32_t uAccel = uDiff * 1000 / ((uTicks) ? uTicks : 1);
+		m_uAccel = (uAccel > UINT16_MAX) ? UINT16_MAX : (uint16_t)uAccel;
 	}
 }
 
@@ -171,7 +310,8 @@ QA_ActiveState QAD_Encoder::getState(void) {
 //QAD_Encoder Control Method
 //
 //Returns the current change in encoder value
-//Takes into account if the encoder mode is set to linear (QAD_EncoderMode_Linear) or exponential (QAD_EncoderMode_Exp)
+//Takes into account if the encoder mode is set to linear (QAD_EncoderMode_Linear), exponential (QAD_EncoderMode_Exp) or curve
+//(QAD_EncoderMode_Curve). The exponential and curve modes are limited to the range of int16_t
 //NOTE: the update() method needs to be called prior to getValue() in order to obtain the most recent value
 //
 //Returns a positive number if encoder is turned clockwise, or a negative number if encoder is turned anti-clockwise
@@ -179,16 +319,8 @@ QA_ActiveState QAD_Encoder::getState(void) {
 int16_t QAD_Encoder::getValue(void) {
 
 	//Check that driver is currently active
-  if (m_eInitState) {
-
-  	//As each click of the encoder generates four quadrature signal 'edges', a single click of the encoder will change the timer
-  	//counter register value by a value of +/- 4. The following code is used to take this into account.
-  	int16_t iOutVal = m_iValue / 4;
-  	m_iValue = m_iValue % 4;
-
-  	//Return the current value based on the currently selected encoder mode
-  	return (m_eMode) ? (iOutVal * iOutVal * iOutVal) : iOutVal;
-  }
+  if (m_eInitState)
+  	return calcValue(m_iValue, m_eMode, *m_pCurve, m_uAccel, m_iCurveFrac);
 
   //Return a value of 0 if the driver is currently inactive
   return 0;
@@ -225,6 +357,302 @@ QAD_EncoderMode QAD_Encoder::getMode(void) {
 }
 
 
+//QAD_Encoder::setCurve
+//QAD_Encoder Control Method
+//
+//Sets the acceleration curve used by QAD_EncoderMode_Curve
+//pCurve - The acceleration curve, which must remain valid while it is in use. Set to nullptr to use the default curve
+void QAD_Encoder::setCurve(const QAD_Encoder_Curve* pCurve) {
+	m_pCurve     = (pCurve) ? pCurve : &m_sDefaultCurve;
+	m_iCurveFrac = 0;
+}
+
+
+//QAD_Encoder::getDefaultCurve
+//QAD_Encoder Control Method
+//
+//Returns a pointer to the default acceleration curve, for use by other encoder drivers
+const QAD_Encoder_Curve* QAD_Encoder::getDefaultCurve(void) {
+	return &m_sDefaultCurve;
+}
+
+
+//QAD_Encoder::calcValue
+//QAD_Encoder Control Method
+//
+//Converts a change in quadrature count into a change in encoder value for an encoder mode, and is shared with other encoder drivers
+//As each click of the encoder generates four quadrature signal 'edges', a single click changes the count by +/- 4. Whole clicks are
+//taken from iCounts, with the remaining counts being left for the next call. The exponential and curve modes are limited to the range
+//of int16_t
+//iCounts    - The change in count not yet converted, which is left holding the remaining counts
+//eMode      - The encoder mode. A member of QAD_EncoderMode as defined in QAD_Encoder.hpp
+//sCurve     - The acceleration curve used by QAD_EncoderMode_Curve
+//uAccel     - The rotation speed in counts per second, used by QAD_EncoderMode_Curve
+//iCurveFrac - The fractional part carried between calls by QAD_EncoderMode_Curve
+int16_t QAD_Encoder::calcValue(int16_t& iCounts, QAD_EncoderMode eMode, const QAD_Encoder_Curve& sCurve, uint16_t uAccel, int16_t& iCurveFrac) {
+	int16_t iOutVal = iCounts / 4;
+	iCounts = iCounts % 4;
+
+	switch (eMode) {
+		case (QAD_EncoderMode_Exp): {
+			int32_t iCube = (int32_t)iOutVal * iOutVal * iOutVal;
+			return (iCube > INT16_MAX) ? INT16_MAX : ((iCube < -INT16_MAX) ? -INT16_MAX : (int16_t)iCube);
+		}
+		case (QAD_EncoderMode_Curve):
+			return sCurve.apply(iOutVal, uAccel, iCurveFrac);
+		default:
+			return iOutVal;
+	}
+}
+
+
+  //----------------------------
+  //----------------------------
+  //QAD_Encoder Velocity Methods
+
+//QAD_Encoder::sampleVelocity
+//QAD_Encoder Velocity Method
+//
+//Used to update the velocity estimate, and is to be called at a fixed rate while the driver is active
+//The signature allows it to be set directly as the update callback of a QAD_Timer driver using QAT_Delegate::fromMember()
+//If any edges were captured since the previous sample, velocity is the change in count between the last edge of the previous
+//sample and the last edge of this sample, divided by the time between them (M/T method). If no edges were captured the encoder has
+//moved less than one edge period, so the previous velocity is limited to one edge period over the time since the last edge, which lets
+//it decay smoothly towards zero as the encoder stops
+//The count must change by less than half of the counter period between samples
+//pData - Unused
+void QAD_Encoder::sampleVelocity(void* pData) {
+
+	//Check that velocity estimation is enabled and driver is active
+	if ((!m_eVelocity) || (!m_eState))
+		return;
+
+	//Take sample time, count and latest edge together
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	uint32_t uTime      = QAD_Timestamp::getCycles();
+	uint16_t uCount     = (uint16_t)__HAL_TIM_GET_COUNTER(&m_sHandle);
+	uint32_t uEdgeTime  = m_uEdgeTime;
+	uint16_t uEdgeCount = m_uEdgeCount;
+	uint32_t uEdgeSeq   = m_uEdgeSeq;
+
+	__set_PRIMASK(uPriMask);
+
+	//Find change in count and time since previous sample
+	int32_t  iCounts = getCountDiff(uCount, m_uSampleCount);
+	uint32_t uCycles = uTime - m_uSampleTime;
+	m_uSampleCount   = uCount;
+	m_uSampleTime    = uTime;
+
+	int32_t iVelocity;
+	if (!m_bEdgeTiming) {
+
+		//Edge timing disabled at high speed, so use count over sample period
+		iVelocity = calcVelocity(iCounts, uCycles);
+
+	} else if (uEdgeSeq != m_uPrevEdgeSeq) {
+
+		//Edges captured in this sample, so use count over time between last edges of this and the previous sample
+		if (m_bPrevEdgeValid)
+			iVelocity = calcVelocity(getCountDiff(uEdgeCount, m_uPrevEdgeCount), uEdgeTime - m_uPrevEdgeTime);
+		else
+			iVelocity = calcVelocity(iCounts, uCycles);
+
+		m_uPrevEdgeTime  = uEdgeTime;
+		m_uPrevEdgeCount = uEdgeCount;
+		m_uPrevEdgeSeq   = uEdgeSeq;
+		m_bPrevEdgeValid = true;
+
+	} else if (m_bPrevEdgeValid) {
+
+		//No edges captured in this sample, so limit velocity to one edge period (four counts) over the time since the last edge
+		//Once this time approaches the cycle counter range the previous edge can no longer be used, and velocity is zero
+		uint32_t uSince = uTime - m_uPrevEdgeTime;
+		if (uSince < 0x80000000) {
+			int32_t iLimit = calcVelocity(4, uSince);
+			iVelocity = m_iVelocity;
+			if (iVelocity > iLimit)
+				iVelocity = iLimit;
+			else if (iVelocity < -iLimit)
+				iVelocity = -iLimit;
+		} else {
+			iVelocity        = 0;
+			m_bPrevEdgeValid = false;
+		}
+
+	} else {
+
+		//No edges captured since edge timing was enabled
+		iVelocity = calcVelocity(iCounts, uCycles);
+	}
+	m_iVelocity = iVelocity;
+
+	//Disable edge timing at high speed, and re-enable it once speed has fallen to half of that limit
+	int32_t iAbsCounts = (iCounts < 0) ? -iCounts : iCounts;
+	if ((m_bEdgeTiming) && (iAbsCounts >= QAD_ENCODER_VELOCITY_EDGE_MAX))
+		setEdgeTiming(false);
+	else if ((!m_bEdgeTiming) && (iAbsCounts < (QAD_ENCODER_VELOCITY_EDGE_MAX / 2)))
+		setEdgeTiming(true);
+}
+
+
+//QAD_Encoder::getVelocity
+//QAD_Encoder Velocity Method
+//
+//Returns the most recent velocity estimate in counts per second, as a signed fixed-point value with QAD_ENCODER_VELOCITY_FRACBITS
+//fractional bits (divide by 256 for counts per second). Positive values are in the direction of increasing count
+int32_t QAD_Encoder::getVelocity(void) {
+	return m_iVelocity;
+}
+
+
+  //----------------------------
+  //----------------------------
+  //QAD_Encoder Position Methods
+
+//QAD_Encoder::getPosition
+//QAD_Encoder Position Method
+//
+//Returns the absolute position in counts in extended position mode, which wraps after 2^31 counts in either direction
+//Returns the current counter value if extended position mode is not enabled
+int32_t QAD_Encoder::getPosition(void) {
+	return (int32_t)getPosition64();
+}
+
+
+//QAD_Encoder::getPosition64
+//QAD_Encoder Position Method
+//
+//Returns the absolute position in counts in extended position mode, or the current counter value if extended position mode is not enabled
+//The wrap count is read before and after the counter, and the read is repeated if a wrap was processed in between. If a wrap is pending
+//but has not yet been processed (such as when called with interrupts disabled) it is accounted for from the counter value, so this
+//requires no critical section and can be called from any context
+int64_t QAD_Encoder::getPosition64(void) {
+	TIM_TypeDef* pTimer = m_sHandle.Instance;
+
+	if ((!m_eInitState) || (!m_eExtended))
+		return (m_eInitState) ? (int64_t)pTimer->CNT : 0;
+
+	int32_t  iWraps;
+	uint32_t uSR;
+	uint16_t uCount;
+	do {
+		iWraps = m_iWraps;
+		uSR    = pTimer->SR;
+		uCount = (uint16_t)pTimer->CNT;
+	} while ((iWraps != m_iWraps) || ((pTimer->SR ^ uSR) & TIM_SR_UIF));
+
+	//Account for pending wrap
+	if ((uSR & TIM_SR_UIF) && (pTimer->DIER & TIM_DIER_UIE))
+		iWraps += (uCount < 0x8000) ? 1 : -1;
+
+	return ((int64_t)iWraps << 16) + uCount;
+}
+
+
+//QAD_Encoder::setPosition
+//QAD_Encoder Position Method
+//
+//Used to set the absolute position in extended position mode, or the counter value if extended position mode is not enabled
+//iPosition - The new position in counts
+void QAD_Encoder::setPosition(int64_t iPosition) {
+	if (!m_eInitState)
+		return;
+
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	if (m_eExtended) {
+		m_sHandle.Instance->CNT = (uint16_t)(iPosition & 0xFFFF);
+		m_sHandle.Instance->SR  = ~TIM_SR_UIF;
+		m_iWraps                = (int32_t)(iPosition >> 16);
+	} else {
+		int64_t iRange = (int64_t)m_uMaxVal + 1;
+		int64_t iCount = iPosition % iRange;
+		m_sHandle.Instance->CNT = (uint32_t)((iCount < 0) ? (iCount + iRange) : iCount);
+	}
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+  //-------------------------
+  //-------------------------
+  //QAD_Encoder Index Methods
+
+//QAD_Encoder::setIndexHandler
+//QAD_Encoder Index Method
+//
+//Used to set a callback delegate to be called at each index, after the index position and count error have been updated
+//The delegate is called from interrupt context, and is passed a pointer to the QAD_Encoder class
+//sHandler - The callback delegate (QAT_Delegate defined in QAT_Delegate.hpp)
+void QAD_Encoder::setIndexHandler(const QAT_Delegate& sHandler) {
+	m_sIndexHandler = sHandler;
+}
+
+
+//QAD_Encoder::resetIndex
+//QAD_Encoder Index Method
+//
+//Used to clear the index data, so that the next index is treated as the first index
+//If position reset is enabled the position will be set to 0 again at the next index (homing)
+void QAD_Encoder::resetIndex(void) {
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	m_bIndexed       = false;
+	m_iIndexRef      = 0;
+	m_iIndexPosition = 0;
+	m_iIndexError    = 0;
+	m_uIndexCount    = 0;
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+//QAD_Encoder::getIndexed
+//QAD_Encoder Index Method
+//
+//Returns true once an index has been detected since the driver was started or resetIndex() was called
+bool QAD_Encoder::getIndexed(void) {
+	return m_bIndexed;
+}
+
+
+//QAD_Encoder::getIndexPosition
+//QAD_Encoder Index Method
+//
+//Returns the position latched at the most recent index, before any correction was applied
+int64_t QAD_Encoder::getIndexPosition(void) {
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+	int64_t iPosition = m_iIndexPosition;
+	__set_PRIMASK(uPriMask);
+	return iPosition;
+}
+
+
+//QAD_Encoder::getIndexError
+//QAD_Encoder Index Method
+//
+//Returns the count error at the most recent index, being the difference between the latched position and the nearest whole number of
+//revolutions from the first index. A non-zero value indicates missed or extra counts, such as from electrical noise
+//Returns 0 at the first index, or if uCountsPerRev was set to 0
+int32_t QAD_Encoder::getIndexError(void) {
+	return m_iIndexError;
+}
+
+
+//QAD_Encoder::getIndexCount
+//QAD_Encoder Index Method
+//
+//Returns the number of index pulses detected since the driver was started or resetIndex() was called
+uint32_t QAD_Encoder::getIndexCount(void) {
+	return m_uIndexCount;
+}
+
+
   //------------------------------------------
   //------------------------------------------
   //QAD_Encoder Private Initialization Methods
@@ -252,6 +680,13 @@ QA_Result QAD_Encoder::periphInit(void) {
   //GPIO_Init.Alternate = m_uCh2_AF;             //Set alternate function to suit required timer peripheral
   HAL_GPIO_Init(m_pCh2_GPIO, &GPIO_Init);
 
+  //Encoder Index GPIO Initialization (Capture Mode)
+  if (m_eIndexMode == QAD_Encoder_IndexCapture) {
+  	GPIO_Init.Pin     = m_uIdx_Pin;            //Set pin number
+  	GPIO_Init.Mode    = GPIO_MODE_AF_INPUT;    //Set pin as Alternate Function input
+  	HAL_GPIO_Init(m_pIdx_GPIO, &GPIO_Init);
+  }
+
   //Enable Timer Clock
   QAD_TimerMgr::enableClock(m_eTimer);
 
@@ -281,6 +716,38 @@ QA_Result QAD_Encoder::periphInit(void) {
   	return QA_Fail;
   }
 
+  //Configure channel 3 to capture the counter on the index edge (Capture Mode)
+  if (m_eIndexMode == QAD_Encoder_IndexCapture) {
+  	TIM_IC_InitTypeDef IC_Init = {0};
+  	IC_Init.ICPolarity  = (m_eIndexEdge == QAD_Encoder_IndexFalling) ? TIM_ICPOLARITY_FALLING : TIM_ICPOLARITY_RISING;
+  	IC_Init.ICSelection = TIM_ICSELECTION_DIRECTTI;  //Set IC3 to direct connection mode
+  	IC_Init.ICPrescaler = TIM_ICPSC_DIV1;            //IC3 capture performed on each edge
+  	IC_Init.ICFilter    = 0x0;                       //Disable IC3 input capture filter
+  	if (HAL_TIM_IC_ConfigChannel(&m_sHandle, &IC_Init, TIM_CHANNEL_3) != HAL_OK) {
+  		HAL_TIM_Encoder_DeInit(&m_sHandle);
+  		periphDeinit(DeinitPartial);
+  		return QA_Fail;
+  	}
+  	m_sHandle.Instance->CCER |= TIM_CCER_CC3E;     //Enable channel 3 capture
+  }
+
+  //Create external interrupt driver for the index signal, with the counter being latched by indexEXTI() (EXTI Mode)
+  if (m_eIndexMode == QAD_Encoder_IndexEXTI) {
+  	m_pIndexEXTI = std::make_unique<QAD_EXTI>(m_pIdx_GPIO, m_uIdx_Pin, QAD_GPIO_PullMode_NoPull,
+  		(m_eIndexEdge == QAD_Encoder_IndexFalling) ? QAD_EXTI_EdgeType_Falling : QAD_EXTI_EdgeType_Rising);
+  	m_pIndexEXTI->setHandler(QAT_Delegate::fromMember<QAD_Encoder, &QAD_Encoder::indexEXTI>(this));
+  }
+
+  //Set IRQ priorities and enable IRQs used for counter wraps and edge timing. These are the same IRQ for general purpose timers
+  if (m_eExtended) {
+  	HAL_NVIC_SetPriority(QAD_TimerMgr::getUpdateIRQ(m_eTimer), m_uIRQPriority, 0);
+  	HAL_NVIC_EnableIRQ(QAD_TimerMgr::getUpdateIRQ(m_eTimer));
+  }
+  if ((m_eVelocity) || (m_eIndexMode == QAD_Encoder_IndexCapture)) {
+  	HAL_NVIC_SetPriority(QAD_TimerMgr::getCCIRQ(m_eTimer), m_uIRQPriority, 0);
+  	HAL_NVIC_EnableIRQ(QAD_TimerMgr::getCCIRQ(m_eTimer));
+  }
+
   //Set Driver States
   m_eInitState = QA_Initialized; //Set driver state as initialized
   m_eState     = QA_Inactive;    //Set driver as currently inactive
@@ -302,6 +769,15 @@ void QAD_Encoder::periphDeinit(QAD_Encoder::DeinitMode eDeinitMode) {
 	//Check if full deinitialization is required
 	if (eDeinitMode) {
 
+		//Disable IRQs
+		if (m_eExtended)
+			HAL_NVIC_DisableIRQ(QAD_TimerMgr::getUpdateIRQ(m_eTimer));
+		if ((m_eVelocity) || (m_eIndexMode == QAD_Encoder_IndexCapture))
+			HAL_NVIC_DisableIRQ(QAD_TimerMgr::getCCIRQ(m_eTimer));
+
+		//Destroy index external interrupt driver
+		m_pIndexEXTI.reset();
+
 		//Deinitialize Timer Peripheral
 		HAL_TIM_Encoder_DeInit(&m_sHandle);
 	}
@@ -312,6 +788,8 @@ void QAD_Encoder::periphDeinit(QAD_Encoder::DeinitMode eDeinitMode) {
 	//Deinit GPIOs
 	HAL_GPIO_DeInit(m_pCh1_GPIO, m_uCh1_Pin);
 	HAL_GPIO_DeInit(m_pCh2_GPIO, m_uCh2_Pin);
+	if (m_eIndexMode == QAD_Encoder_IndexCapture)
+		HAL_GPIO_DeInit(m_pIdx_GPIO, m_uIdx_Pin);
 
 	//Set States
 	m_eState     = QA_Inactive;        //Set driver as currently inactive
@@ -332,6 +810,135 @@ void QAD_Encoder::clearData(void) {
   m_uValueNew = 0;
   m_iValue    = 0;
   m_uAccel    = 0;
+  m_iWraps    = 0;
   __HAL_TIM_SET_COUNTER(&m_sHandle, 0);
 }
 
+
+//QAD_Encoder::getCountDiff
+//QAD_Encoder Private Tool Method
+//
+//Returns the signed change between two counter values, taking the shortest path around the counter period
+//uNew - The later counter value
+//uOld - The earlier counter value
+int32_t QAD_Encoder::getCountDiff(uint16_t uNew, uint16_t uOld) {
+	int32_t iRange = (int32_t)m_uMaxVal + 1;
+	int32_t iDiff  = (int32_t)uNew - (int32_t)uOld;
+
+	if (iDiff > (iRange / 2))
+		iDiff -= iRange;
+	else if (iDiff < -(iRange / 2))
+		iDiff += iRange;
+	return iDiff;
+}
+
+
+//QAD_Encoder::calcVelocity
+//QAD_Encoder Private Tool Method
+//
+//Returns a velocity in counts per second with QAD_ENCODER_VELOCITY_FRACBITS fractional bits
+//iCounts - The change in count
+//uCycles - The number of core clock cycles over which the change occurred. A value of 0 returns 0
+int32_t QAD_Encoder::calcVelocity(int32_t iCounts, uint32_t uCycles) {
+	if (!uCycles)
+		return 0;
+
+	return (int32_t)(((int64_t)iCounts * ((int64_t)QAD_Timestamp::getCoreClock() << QAD_ENCODER_VELOCITY_FRACBITS)) / (int64_t)uCycles);
+}
+
+
+//QAD_Encoder::setEdgeTiming
+//QAD_Encoder Private Tool Method
+//
+//Used to enable or disable the channel 1 capture interrupt used to timestamp encoder edges
+//When enabled, the previous edge is invalidated as edges may have been missed while edge timing was disabled
+//bEnable - Set to true to enable edge timing, or false to disable it
+void QAD_Encoder::setEdgeTiming(bool bEnable) {
+	TIM_TypeDef* pTimer = m_sHandle.Instance;
+
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	if (bEnable) {
+		pTimer->SR       = ~(TIM_SR_CC1IF | TIM_SR_CC1OF);
+		m_uPrevEdgeSeq   = m_uEdgeSeq;
+		m_bPrevEdgeValid = false;
+		pTimer->DIER    |= TIM_DIER_CC1IE;
+	} else {
+		pTimer->DIER    &= ~TIM_DIER_CC1IE;
+	}
+	m_bEdgeTiming = bEnable;
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+  //---------------------------------
+  //---------------------------------
+  //QAD_Encoder Private Index Methods
+
+//QAD_Encoder::indexEXTI
+//QAD_Encoder Private Index Method
+//
+//Callback delegate of the index external interrupt driver, which latches the counter in software (EXTI Mode)
+//pData - Unused
+void QAD_Encoder::indexEXTI(void* pData) {
+	processIndex((uint16_t)m_sHandle.Instance->CNT);
+}
+
+
+//QAD_Encoder::processIndex
+//QAD_Encoder Private Index Method
+//
+//Used to process an index, being called from either the timer or external interrupt handler
+//The latched counter value is converted to an absolute position using the current position, as the counter may have moved on since it was
+//latched. The count error is found from the nearest whole number of revolutions from the first index. If position reset is enabled the
+//position is moved so that the first index is at 0, and is then corrected by the count error at each following index
+//uLatched - The counter value latched at the index edge
+void QAD_Encoder::processIndex(uint16_t uLatched) {
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	int64_t iNow     = getPosition64();
+	int64_t iLatched = iNow - getCountDiff((uint16_t)iNow, uLatched);
+	int64_t iDelta   = 0;
+	int32_t iError   = 0;
+
+	if (!m_bIndexed) {
+
+		//First index sets the reference position, which is moved to 0 if position reset is enabled
+		if (m_eIndexReset) {
+			iDelta      = -iLatched;
+			m_iIndexRef = 0;
+		} else {
+			m_iIndexRef = iLatched;
+		}
+
+	} else if (m_uCountsPerRev) {
+
+		//Find count error from the nearest whole number of revolutions from the reference position
+		int64_t iRev   = (int64_t)m_uCountsPerRev;
+		int64_t iRel   = iLatched - m_iIndexRef;
+		int64_t iTurns = (iRel >= 0) ? ((iRel + (iRev / 2)) / iRev) : -((-iRel + (iRev / 2)) / iRev);
+		iError = (int32_t)(iRel - (iTurns * iRev));
+
+		//Correct position by count error if position reset is enabled
+		if (m_eIndexReset)
+			iDelta = -iError;
+	}
+
+	//Apply position correction
+	if (iDelta)
+		setPosition(getPosition64() + iDelta);
+
+	//Update index data
+	m_iIndexPosition = iLatched;
+	m_iIndexError    = iError;
+	m_uIndexCount++;
+	m_bIndexed       = true;
+
+	__set_PRIMASK(uPriMask);
+
+	//Call index handler
+	m_sIndexHandler(this);
+}
@@ -22,7 +22,12 @@
 //Includes
 #include "setup.hpp"
 
+#include <memory>
+
 #include "QAD_TimerMgr.hpp"
+#include "QAD_Timestamp.hpp"
+#include "QAD_EXTI.hpp"
+#include "QAT_Delegate.hpp"
 
 
 	//------------------------------------------
@@ -38,11 +43,95 @@ enum QAD_EncoderMode : uint8_t {
 	QAD_EncoderMode_Linear = 0,  //Linear mode - each "click" of the encoder results in a change in value of +/- 1
 			                         //Best used when needing to scroll through a small number of values/settings
 
-	QAD_EncoderMode_Exp          //Exponential mode - speed at which encoder is rotated results in smaller or larger value changes
+	QAD_EncoderMode_Exp,         //Exponential mode - speed at which encoder is rotated results in smaller or larger value changes
 	                             //Best used when needing to scroll through a large number of values/settings
+
+	QAD_EncoderMode_Curve        //Curve mode - each "click" is multiplied by a gain looked up from the measured rotation speed
+	                             //Gain is set by a QAD_Encoder_Curve acceleration curve, with fractional gains being carried between calls
+};
+
+
+//----------------------
+//QAD_ENCODER_CURVE_SIZE
+//
+//Number of entries in an acceleration curve, and number of fractional bits of each entry's gain (Q8.8, so 256 is a gain of 1.0)
+#define QAD_ENCODER_CURVE_SIZE      16
+#define QAD_ENCODER_CURVE_FRACBITS  8
+
+
+//-----------------
+//QAD_Encoder_Curve
+//
+//Acceleration curve used by QAD_EncoderMode_Curve, mapping the rotation speed measured by QAD_Encoder::update() to a gain
+//Entry n is used for speeds from (n * uStep) up to ((n + 1) * uStep) counts per second, with the last entry used for all higher speeds
+//A curve can either be written as a table of gains, or generated by the compiler as a square law curve from 1.0 up to a maximum gain,
+//and declaring the curve constexpr places it in flash with no runtime cost
+struct QAD_Encoder_Curve {
+
+	uint16_t uStep;                            //Speed range of each entry in counts per second
+	uint16_t uGain[QAD_ENCODER_CURVE_SIZE];    //Gain of each entry, with QAD_ENCODER_CURVE_FRACBITS fractional bits
+
+	//Used to create a curve from a table of gains
+	//uStepVal - Speed range of each entry in counts per second
+	//uGains   - Gain of each entry, with QAD_ENCODER_CURVE_FRACBITS fractional bits
+	constexpr QAD_Encoder_Curve(uint16_t uStepVal, const uint16_t (&uGains)[QAD_ENCODER_CURVE_SIZE]) : uStep(uStepVal), uGain() {
+		for (uint32_t i=0; i<QAD_ENCODER_CURVE_SIZE; i++)
+			uGain[i] = uGains[i];
+	}
+
+	//Used to generate a square law curve, rising from a gain of 1.0 in the first entry to uMaxGain in the last entry
+	//uStepVal - Speed range of each entry in counts per second
+	//uMaxGain - Gain of the last entry, with QAD_ENCODER_CURVE_FRACBITS fractional bits (no lower than 256)
+	constexpr QAD_Encoder_Curve(uint16_t uStepVal, uint16_t uMaxGain) : uStep(uStepVal), uGain() {
+		const uint32_t uOne  = 1 << QAD_ENCODER_CURVE_FRACBITS;
+		const uint32_t uLast = (QAD_ENCODER_CURVE_SIZE - 1) * (QAD_ENCODER_CURVE_SIZE - 1);
+		const uint32_t uRise = (uMaxGain > uOne) ? (uMaxGain - uOne) : 0;
+		for (uint32_t i=0; i<QAD_ENCODER_CURVE_SIZE; i++)
+			uGain[i] = (uint16_t)(uOne + (((uRise * i * i) + (uLast / 2)) / uLast));
+	}
+
+	//Used to scale a number of clicks by the gain for a rotation speed, as detailed in QAD_Encoder.cpp
+	int16_t apply(int16_t iClicks, uint16_t uAccel, int16_t& iFrac) const;
+};
+
+
+//---------------------
+//QAD_Encoder_IndexMode
+//
+//Used with QAD_Encoder driver class to select how the encoder's index (Z channel) signal is connected
+enum QAD_Encoder_IndexMode : uint8_t {
+	QAD_Encoder_IndexNone = 0,   //Index signal is not used
+	QAD_Encoder_IndexCapture,    //Index signal is connected to channel 3 of the selected timer, which latches the counter in hardware
+	QAD_Encoder_IndexEXTI        //Index signal is connected to any GPIO pin, with the counter being latched by the external interrupt
 };
 
 
+//---------------------
+//QAD_Encoder_IndexEdge
+//
+//Used with QAD_Encoder driver class to select which edge of the index signal marks the index position
+enum QAD_Encoder_IndexEdge : uint8_t {
+	QAD_Encoder_IndexRising = 0,
+	QAD_Encoder_IndexFalling
+};
+
+
+//-----------------------------
+//QAD_ENCODER_VELOCITY_FRACBITS
+//
+//Number of fractional bits of the fixed-point velocity returned by QAD_Encoder::getVelocity()
+#define QAD_ENCODER_VELOCITY_FRACBITS  8
+
+
+//-----------------------------
+//QAD_ENCODER_VELOCITY_EDGE_MAX
+//
+//Number of counts per velocity sample above which edge timing is disabled and velocity is found from the count alone
+//Above this speed the count gives better than 1/QAD_ENCODER_VELOCITY_EDGE_MAX resolution, and the edge interrupt rate is kept bounded.
+//Edge timing is re-enabled once the count per sample falls below half of this value
+#define QAD_ENCODER_VELOCITY_EDGE_MAX  32
+
+
 //----------------------
 //QAD_Encoder_InitStruct
 //
@@ -60,7 +149,25 @@ typedef struct {
 	QAD_Timer_Periph  eTimer;    //Timer peripheral to be used (member of QAD_Timer_Periph, as defined in QAD_TimerMgr.hpp)
 	                             //Note that the selected timer must have rotary encoder mode support
 
-	QAD_EncoderMode   eMode;     //Encoder output data mode (QAD_EncoderMode_Linear or QAD_EncoderMode_Exp)
+	QAD_EncoderMode   eMode;     //Encoder output data mode (QAD_EncoderMode_Linear, QAD_EncoderMode_Exp or QAD_EncoderMode_Curve)
+	const QAD_Encoder_Curve* pCurve; //Acceleration curve used by QAD_EncoderMode_Curve, which must remain valid while the driver exists
+	                                 //Set to nullptr to use the default curve
+
+	QA_ActiveState    eExtended;     //Set to QA_Active to enable extended position mode, which uses the full 16bit counter and the timer's
+	                                 //update interrupt to track the absolute position using getPosition() and getPosition64()
+	QA_ActiveState    eVelocity;     //Set to QA_Active to enable velocity estimation using sampleVelocity() and getVelocity()
+	                                 //This requires the timer's capture/compare interrupt and the QAD_Timestamp cycle counter
+	uint8_t           uIRQPriority;  //IRQ Priority for the timer's interrupts (a value between 0 and 15)
+
+	QAD_Encoder_IndexMode eIndexMode;     //How the index signal is connected. Member of QAD_Encoder_IndexMode
+	                                      //Requires extended position mode to be enabled
+	GPIO_TypeDef*     pIdx_GPIO;          //GPIO port to be used for the index signal (the timer's channel 3 pin in capture mode)
+	uint16_t          uIdx_Pin;           //Pin number to be used for the index signal
+	QAD_Encoder_IndexEdge eIndexEdge;     //Edge of the index signal that marks the index position. Member of QAD_Encoder_IndexEdge
+	QA_ActiveState    eIndexReset;        //Set to QA_Active for the position to be set to 0 at the first index, and to be corrected to the nearest
+	                                      //whole revolution at each following index
+	uint32_t          uCountsPerRev;      //Number of counts per revolution (four times the encoder's lines per revolution)
+	                                      //Used to find the count error at each index. Set to 0 if the count error is not required
 
 } QAD_Encoder_InitStruct;
 
@@ -73,16 +180,42 @@ typedef struct {
 //QAD_Encoder
 //
 //Driver class for using timer peripheral in rotary encoder mode
+//
+//When velocity estimation is enabled, sampleVelocity() is to be called at a fixed rate, normally from a timer's update callback, and
+//estimates velocity using the M/T method. Channel 1 of the timer captures the counter on each rising edge of the encoder's channel 1
+//signal, and the capture interrupt timestamps it using the QAD_Timestamp cycle counter. Velocity is then the change in count between
+//the last edges of consecutive samples, divided by the time between those edges. This measures the whole number of edges in each
+//sample, so does not read zero at low speeds or jitter by one count per sample at high speeds. At high speeds, where the count per
+//sample alone is precise, edge timing is disabled to bound the interrupt rate.
+//
+//In extended position mode the counter runs over its full 16bit range, and the update interrupt counts each wrap of the counter in
+//either direction to maintain a 48bit absolute position. The direction of each wrap is found from the counter value in the interrupt
+//(near zero after counting up, near 65535 after counting down) rather than the DIR bit, so an encoder sitting on the wrap point cannot
+//cause a wrap to be counted in the wrong direction. The position is correct however rarely it is read, and getPosition() and
+//getPosition64() can be called from any context without disabling interrupts.
+//
+//The index (Z channel) signal can be connected either to channel 3 of the timer, which captures the counter in hardware, or to any GPIO
+//pin using an external interrupt. At each index the position of the index is latched, and its count error is found as the difference
+//from the nearest whole number of revolutions from the first index. Optionally, the position is set to 0 at the first index and then
+//corrected by the count error at each following index, giving drift-free absolute positioning from the first index pulse
+//
+//The handler() method is to be called from the IRQ handler function of the selected timer within handlers.cpp when either extended
+//position mode, velocity estimation or index capture is enabled. For Timer 1 both the update (TIM1_UP_IRQn) and capture/compare
+//(TIM1_CC_IRQn) IRQs are used. In index EXTI mode, the index pin's external interrupt is routed to the driver by QAD_EXTIMgr
 class QAD_Encoder {
 private:
 
+	//Default acceleration curve, rising from 1x to 32x over 0 to 960 counts per second (0 to 240 clicks per second)
+	static constexpr QAD_Encoder_Curve m_sDefaultCurve = QAD_Encoder_Curve(64, 32 << QAD_ENCODER_CURVE_FRACBITS);
+
 	//Deinitialization mode to be used by periphDeinit() method
 	enum DeinitMode : uint8_t {
 		DeinitPartial = 0,    //Only to be used for partial deinitialization upon initialization failure in periphInit() method
 		DeinitFull            //Used for full driver deinitialization when driver is in a fully initialized state
 	};
 
-	const uint16_t     m_uMaxVal = 1024;  //Value used for timer period and encoder value calculation
+	uint16_t           m_uMaxVal;         //Value used for timer period and encoder value calculation
+	                                      //1024, or 0xFFFF in extended position mode
 
 	GPIO_TypeDef*      m_pCh1_GPIO;       //GPIO port to be used for channel 1 of the encoder's quadrature signal
 	uint16_t           m_uCh1_Pin;        //Pin number to be used for channel 1 of the encoder's quadrature signal
@@ -108,6 +241,45 @@ private:
 
 	QAD_EncoderMode    m_eMode;           //Stores whether the encoder data output is in linear or exponential mode
 	                                      //See QAD_EncoderMode definition for further details
+	const QAD_Encoder_Curve* m_pCurve;    //Acceleration curve used by QAD_EncoderMode_Curve
+	int16_t            m_iCurveFrac;      //Fractional part of the scaled value carried between calls to getValue() in curve mode
+
+	QA_ActiveState     m_eExtended;       //Stores whether extended position mode is enabled
+	volatile int32_t   m_iWraps;          //Number of counter wraps in extended position mode, forming the upper bits of the position
+
+	QA_ActiveState     m_eVelocity;       //Stores whether velocity estimation is enabled
+	uint8_t            m_uIRQPriority;    //IRQ Priority for the timer's interrupts
+
+	volatile uint32_t  m_uEdgeTime;       //Cycle count of the most recent encoder edge, written by handler()
+	volatile uint16_t  m_uEdgeCount;      //Counter value captured at the most recent encoder edge, written by handler()
+	volatile uint32_t  m_uEdgeSeq;        //Incremented by handler() for each encoder edge
+
+	uint32_t           m_uPrevEdgeTime;   //Cycle count of the last edge used by the previous velocity sample
+	uint16_t           m_uPrevEdgeCount;  //Counter value of the last edge used by the previous velocity sample
+	uint32_t           m_uPrevEdgeSeq;    //Edge sequence number at the previous velocity sample
+	bool               m_bPrevEdgeValid;  //Stores whether the previous edge can be used for edge timing
+	bool               m_bEdgeTiming;     //Stores whether edge timing is currently enabled
+
+	uint32_t           m_uSampleTime;     //Cycle count at the previous velocity sample
+	uint16_t           m_uSampleCount;    //Counter value at the previous velocity sample
+	volatile int32_t   m_iVelocity;       //Most recent velocity in counts per second, with QAD_ENCODER_VELOCITY_FRACBITS fractional bits
+
+	QAD_Encoder_IndexMode m_eIndexMode;   //Stores how the index signal is connected
+	GPIO_TypeDef*      m_pIdx_GPIO;       //GPIO port to be used for the index signal
+	uint16_t           m_uIdx_Pin;        //Pin number to be used for the index signal
+	QAD_Encoder_IndexEdge m_eIndexEdge;   //Edge of the index signal that marks the index position
+	QA_ActiveState     m_eIndexReset;     //Stores whether the position is reset and corrected at each index
+	uint32_t           m_uCountsPerRev;   //Number of counts per revolution
+
+	std::unique_ptr<QAD_EXTI> m_pIndexEXTI;  //External interrupt driver used for the index signal in index EXTI mode
+
+	volatile bool      m_bIndexed;        //Set once the first index has been detected
+	int64_t            m_iIndexRef;       //Position of the first index, from which whole revolutions are measured (0 if reset is enabled)
+	int64_t            m_iIndexPosition;  //Latched position of the most recent index, before any correction
+	volatile int32_t   m_iIndexError;     //Count error at the most recent index
+	volatile uint32_t  m_uIndexCount;     //Number of index pulses detected since the driver was started
+
+	QAT_Delegate       m_sIndexHandler;   //Callback delegate to be called at each index (QAT_Delegate defined in QAT_Delegate.hpp)
 
 public:
 
@@ -117,6 +289,7 @@ public:
   QAD_Encoder() = delete;                        //Delete the default class constructor, as we need an initialization structor to be provided on class creation
 
   QAD_Encoder(QAD_Encoder_InitStruct& sInit) :  //The class constructor to be used, which has a reference to an initialization structure passed to it
+  	m_uMaxVal((sInit.eExtended) ? 0xFFFF : 1024),
   	m_pCh1_GPIO(sInit.pCh1_GPIO),
 		m_uCh1_Pin(sInit.uCh1_Pin),
 		//m_uCh1_AF(sInit.uCh1_AF),
@@ -131,7 +304,37 @@ public:
 		m_uValueNew(0),
 		m_iValue(0),
 		m_uAccel(0),
-		m_eMode(sInit.eMode) {};
+		m_eMode(sInit.eMode),
+		m_pCurve((sInit.pCurve) ? sInit.pCurve : &m_sDefaultCurve),
+		m_iCurveFrac(0),
+		m_eExtended(sInit.eExtended),
+		m_iWraps(0),
+		m_eVelocity(sInit.eVelocity),
+		m_uIRQPriority(sInit.uIRQPriority),
+		m_uEdgeTime(0),
+		m_uEdgeCount(0),
+		m_uEdgeSeq(0),
+		m_uPrevEdgeTime(0),
+		m_uPrevEdgeCount(0),
+		m_uPrevEdgeSeq(0),
+		m_bPrevEdgeValid(false),
+		m_bEdgeTiming(false),
+		m_uSampleTime(0),
+		m_uSampleCount(0),
+		m_iVelocity(0),
+		m_eIndexMode(sInit.eIndexMode),
+		m_pIdx_GPIO(sInit.pIdx_GPIO),
+		m_uIdx_Pin(sInit.uIdx_Pin),
+		m_eIndexEdge(sInit.eIndexEdge),
+		m_eIndexReset(sInit.eIndexReset),
+		m_uCountsPerRev(sInit.uCountsPerRev),
+		m_pIndexEXTI(nullptr),
+		m_bIndexed(false),
+		m_iIndexRef(0),
+		m_iIndexPosition(0),
+		m_iIndexError(0),
+		m_uIndexCount(0),
+		m_sIndexHandler() {};
 
   ~QAD_Encoder() {       //Destructor to make sure peripheral is mode inactive and deinitialized upon class destruction
 
@@ -154,10 +357,16 @@ public:
   void deinit(void);
 
 
+  //-------------------
+  //IRQ Handler Methods
+
+  void handler(void);
+
+
   //---------------
   //Control Methods
 
-  void start(void);
+  QA_Result start(void);
   void stop(void);
 
   void update(uint32_t uTicks);
@@ -169,6 +378,37 @@ public:
   void setMode(QAD_EncoderMode eMode);
   QAD_EncoderMode getMode(void);
 
+  void setCurve(const QAD_Encoder_Curve* pCurve);
+  static const QAD_Encoder_Curve* getDefaultCurve(void);
+  static int16_t calcValue(int16_t& iCounts, QAD_EncoderMode eMode, const QAD_Encoder_Curve& sCurve, uint16_t uAccel, int16_t& iCurveFrac);
+
+
+  //----------------
+  //Velocity Methods
+
+  void sampleVelocity(void* pData);
+  int32_t getVelocity(void);
+
+
+  //----------------
+  //Position Methods
+
+  int32_t getPosition(void);
+  int64_t getPosition64(void);
+  void setPosition(int64_t iPosition);
+
+
+  //-------------
+  //Index Methods
+
+  void setIndexHandler(const QAT_Delegate& sHandler);
+  void resetIndex(void);
+
+  bool getIndexed(void);
+  int64_t getIndexPosition(void);
+  int32_t getIndexError(void);
+  uint32_t getIndexCount(void);
+
 private:
 
   //----------------------
@@ -182,6 +422,16 @@ private:
   //Tool Methods
 
   void clearData(void);
+  int32_t getCountDiff(uint16_t uNew, uint16_t uOld);
+  int32_t calcVelocity(int32_t iCounts, uint32_t uCycles);
+  void setEdgeTiming(bool bEnable);
+
+
+  //---------------------
+  //Private Index Methods
+
+  void indexEXTI(void* pData);
+  void processIndex(uint16_t uLatched);
 
 };
 
@@ -0,0 +1,328 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Software Rotary Encoder Driver                                  */
+/*   Filename: QAD_EncoderSoft.cpp                                         */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_EncoderSoft.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//Definition of quadrature state transition table, required as it is indexed at runtime by decode()
+constexpr int8_t QAD_EncoderSoft::m_iTransitions[16];
+
+
+  //--------------------------------------
+  //--------------------------------------
+  //QAD_EncoderSoft Initialization Methods
+
+//QAD_EncoderSoft::init
+//QAD_EncoderSoft Initialization Method
+//
+//Used to initialize the encoder driver, creating the external interrupt drivers for both pins
+//Returns QA_OK if initialization successful, or QA_Fail if both pins have the same pin number
+//        QA_Error_PeriphBusy if either pin's external interrupt line is in use by another driver
+QA_Result QAD_EncoderSoft::init(void) {
+
+	//Return if already initialized
+	if (m_eInitState)
+		return QA_OK;
+
+	//Check that the pins use different external interrupt lines, and that both lines are available
+	if (m_uCh1_Pin == m_uCh2_Pin)
+		return QA_Fail;
+	if ((QAD_EXTIMgr::getDriver(QAD_EXTIMgr::getLine(m_uCh1_Pin))) || (QAD_EXTIMgr::getDriver(QAD_EXTIMgr::getLine(m_uCh2_Pin))))
+		return QA_Error_PeriphBusy;
+
+	//Create external interrupt drivers, interrupting on both edges of each pin
+	m_pCh1_EXTI = std::make_unique<QAD_EXTI>(m_pCh1_GPIO, m_uCh1_Pin, m_ePull, QAD_EXTI_EdgeType_Both);
+	m_pCh2_EXTI = std::make_unique<QAD_EXTI>(m_pCh2_GPIO, m_uCh2_Pin, m_ePull, QAD_EXTI_EdgeType_Both);
+
+	//Set callback delegates, which are called by QAD_EXTIMgr when either line is triggered
+	m_pCh1_EXTI->setHandler(QAT_Delegate::fromMember<QAD_EncoderSoft, &QAD_EncoderSoft::edge>(this));
+	m_pCh2_EXTI->setHandler(QAT_Delegate::fromMember<QAD_EncoderSoft, &QAD_EncoderSoft::edge>(this));
+
+	//Set Driver States
+	m_eInitState = QA_Initialized;
+	m_eState     = QA_Inactive;
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_EncoderSoft::deinit
+//QAD_EncoderSoft Initialization Method
+//
+//Used to deinitialize the encoder driver, destroying the external interrupt drivers which also deinitializes both pins
+void QAD_EncoderSoft::deinit(void) {
+
+	//Return if encoder driver is not currently initialized
+	if (!m_eInitState)
+		return;
+
+	//Stop encoder driver if currently active
+	if (m_eState)
+		stop();
+
+	//Destroy external interrupt drivers
+	m_pCh1_EXTI.reset();
+	m_pCh2_EXTI.reset();
+
+	//Set Driver State
+	m_eInitState = QA_NotInitialized;
+}
+
+
+  //-------------------------------
+  //-------------------------------
+  //QAD_EncoderSoft Control Methods
+
+//QAD_EncoderSoft::start
+//QAD_EncoderSoft Control Method
+//
+//This method is used to clear the encoder data and enable the external interrupts of both pins
+//Returns QA_OK if successful, or if the driver is already active
+//        QA_Fail if the driver is not initialized
+//        QA_Error_PeriphBusy if either pin's external interrupt line has been claimed by another driver, in which case the driver is
+//        left inactive
+QA_Result QAD_EncoderSoft::start(void) {
+
+	//Check encoder driver is initialized
+	if (!m_eInitState)
+		return QA_Fail;
+
+	//Check encoder driver is not currently active
+	if (!m_eState) {
+
+		//Clear encoder data
+		m_iCount     = 0;
+		m_iCountOld  = 0;
+		m_iValue     = 0;
+		m_uAccel     = 0;
+		m_iCurveFrac = 0;
+
+		//Enable external interrupts, which claims their lines, then take the initial quadrature state with both interrupts masked
+		QA_Result eRes = m_pCh1_EXTI->enable();
+		if (eRes)
+			return eRes;
+
+		eRes = m_pCh2_EXTI->enable();
+		if (eRes) {
+			m_pCh1_EXTI->disable();
+			return eRes;
+		}
+
+		uint32_t uPriMask = __get_PRIMASK();
+		__disable_irq();
+		EXTI->PR     = (m_uCh1_Pin | m_uCh2_Pin);
+		m_uPrevState = readState();
+		__set_PRIMASK(uPriMask);
+
+		//Set driver state to active
+		m_eState = QA_Active;
+	}
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_EncoderSoft::stop
+//QAD_EncoderSoft Control Method
+//
+//This method is used to disable the external interrupts of both pins
+void QAD_EncoderSoft::stop(void) {
+
+	//Check encoder driver is initialized and is currently active
+	if ((m_eInitState) && (m_eState)) {
+
+		//Disable external interrupts
+		m_pCh1_EXTI->disable();
+		m_pCh2_EXTI->disable();
+
+		//Set driver state to inactive
+		m_eState = QA_Inactive;
+	}
+}
+
+
+//QAD_EncoderSoft::update
+//QAD_EncoderSoft Control Method
+//
+//This method is used to update the encoder data and should be called at a regular rate, as with QAD_Encoder::update()
+//uTicks - The time (in milliseconds) that has passed since this method was last called, with a value of 0 being treated as 1
+void QAD_EncoderSoft::update(uint32_t uTicks) {
+
+	//Check that encoder driver is active
+	if (m_eState) {
+
+		//Find change in count since previous update. Only the low 32bits are needed, as the change is far smaller than 2^31 counts
+		int32_t iCount = (int32_t)getPosition64();
+		int32_t iDiff  = iCount - m_iCountOld;
+		m_iCountOld    = iCount;
+
+		uint32_t uDiff = (uint32_t)((iDiff < 0) ? -iDiff : iDiff);
+		m_iValue += (int16_t)iDiff;
+
+		//Calculate encoder acceleration value, avoiding division by zero when called more than once per millisecond
+		uint32_t uAccel = uDiff * 1000 / ((uTicks) ? uTicks : 1);
+		m_uAccel = (uAccel > UINT16_MAX) ? UINT16_MAX : (uint16_t)uAccel;
+	}
+}
+
+
+//QAD_EncoderSoft::getState
+//QAD_EncoderSoft Control Method
+//
+//Returns the current state of the encoder driver (QA_Active or QA_Inactive)
+QA_ActiveState QAD_EncoderSoft::getState(void) {
+	return m_eState;
+}
+
+
+//QAD_EncoderSoft::getValue
+//QAD_EncoderSoft Control Method
+//
+//Returns the current change in encoder value in clicks (four counts per click), based on the current encoder mode
+//NOTE: the update() method needs to be called prior to getValue() in order to obtain the most recent value
+//
+//Returns a positive number if encoder is turned clockwise, or a negative number if encoder is turned anti-clockwise
+//If you get opposite results than this then try swapping the two quadrature signal wires
+int16_t QAD_EncoderSoft::getValue(void) {
+
+	//Check that driver is currently initialized
+	if (m_eInitState)
+		return QAD_Encoder::calcValue(m_iValue, m_eMode, *m_pCurve, m_uAccel, m_iCurveFrac);
+
+	//Return a value of 0 if the driver is not initialized
+	return 0;
+}
+
+
+//QAD_EncoderSoft::getAccel
+//QAD_EncoderSoft Control Method
+//
+//Returns the current acceleration value of the encoder in counts per second, regardless of direction
+//NOTE: the update() method needs to be called prior to getAccel() in order to obtain the most recent value
+uint16_t QAD_EncoderSoft::getAccel(void) {
+	return (m_eInitState) ? m_uAccel : 0;
+}
+
+
+//QAD_EncoderSoft::setMode
+//QAD_EncoderSoft Control Method
+//
+//Sets the current encoder mode
+//eMode - A member of QAD_EncoderMode as defined in QAD_Encoder.hpp
+void QAD_EncoderSoft::setMode(QAD_EncoderMode eMode) {
+	m_eMode = eMode;
+}
+
+
+//QAD_EncoderSoft::getMode
+//QAD_EncoderSoft Control Method
+//
+//Returns the current encoder mode. A member of QAD_EncoderMode as defined in QAD_Encoder.hpp
+QAD_EncoderMode QAD_EncoderSoft::getMode(void) {
+	return m_eMode;
+}
+
+
+//QAD_EncoderSoft::setCurve
+//QAD_EncoderSoft Control Method
+//
+//Sets the acceleration curve used by QAD_EncoderMode_Curve
+//pCurve - The acceleration curve, which must remain valid while it is in use. Set to nullptr to use the default curve
+void QAD_EncoderSoft::setCurve(const QAD_Encoder_Curve* pCurve) {
+	m_pCurve     = (pCurve) ? pCurve : QAD_Encoder::getDefaultCurve();
+	m_iCurveFrac = 0;
+}
+
+
+  //--------------------------------
+  //--------------------------------
+  //QAD_EncoderSoft Position Methods
+
+//QAD_EncoderSoft::getPosition
+//QAD_EncoderSoft Position Method
+//
+//Returns the quadrature count since the driver was started, or since setPosition() was called, which wraps after 2^31 counts in either
+//direction
+int32_t QAD_EncoderSoft::getPosition(void) {
+	return (int32_t)getPosition64();
+}
+
+
+//QAD_EncoderSoft::getPosition64
+//QAD_EncoderSoft Position Method
+//
+//Returns the quadrature count since the driver was started, or since setPosition() was called
+//As the 64bit count cannot be read in a single access it is read with interrupts disabled
+int64_t QAD_EncoderSoft::getPosition64(void) {
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	int64_t iCount = m_iCount;
+
+	__set_PRIMASK(uPriMask);
+	return iCount;
+}
+
+
+//QAD_EncoderSoft::setPosition
+//QAD_EncoderSoft Position Method
+//
+//Used to set the quadrature count, without affecting the values returned by getValue()
+//iPosition - The new count
+void QAD_EncoderSoft::setPosition(int64_t iPosition) {
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	m_iCountOld += (int32_t)(iPosition - m_iCount);
+	m_iCount     = iPosition;
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+  //------------------------------------
+  //------------------------------------
+  //QAD_EncoderSoft Private Tool Methods
+
+//QAD_EncoderSoft::edge
+//QAD_EncoderSoft Private Tool Method
+//
+//Callback delegate of both external interrupt drivers. The pending flags have already been cleared by QAD_EXTIMgr before the pins are
+//read, so an edge that occurs while decoding triggers a further interrupt rather than being lost
+//pData - Unused
+void QAD_EncoderSoft::edge(void* pData) {
+	decode();
+}
+
+
+//QAD_EncoderSoft::decode
+//QAD_EncoderSoft Private Tool Method
+//
+//Reads the current quadrature state and updates the count from the state transition table
+//As both pins are read together this also handles edges of both pins arriving in a single interrupt
+void QAD_EncoderSoft::decode(void) {
+	uint8_t uState = readState();
+	m_iCount      += m_iTransitions[(m_uPrevState << 2) | uState];
+	m_uPrevState   = uState;
+}
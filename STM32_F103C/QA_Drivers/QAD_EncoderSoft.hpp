@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Software Rotary Encoder Driver                                  */
+/*   Filename: QAD_EncoderSoft.hpp                                         */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_ENCODERSOFT_HPP_
+#define __QAD_ENCODERSOFT_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include <memory>
+
+#include "QAD_Encoder.hpp"
+#include "QAD_EXTI.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------------------
+//QAD_EncoderSoft_InitStruct
+//
+//This structure is used to be able to create the QAD_EncoderSoft driver class
+typedef struct {
+
+	GPIO_TypeDef*     pCh1_GPIO; //GPIO port to be used for channel 1 of the encoder's quadrature signal
+	uint16_t          uCh1_Pin;  //Pin number to be used for channel 1 of the encoder's quadrature signal
+
+	GPIO_TypeDef*     pCh2_GPIO; //GPIO port to be used for channel 2 of the encoder's quadrature signal
+	uint16_t          uCh2_Pin;  //Pin number to be used for channel 2 of the encoder's quadrature signal
+	                             //Must have a different pin number to channel 1, as each pin number has a single external interrupt line
+
+	QAD_GPIO_PullMode ePull;     //Pull-up or pull-down resistors to be used on both pins. Member of QAD_GPIO_PullMode as defined in QAD_GPIO.hpp
+
+	QAD_EncoderMode   eMode;     //Encoder output data mode (QAD_EncoderMode_Linear, QAD_EncoderMode_Exp or QAD_EncoderMode_Curve)
+	const QAD_Encoder_Curve* pCurve; //Acceleration curve used by QAD_EncoderMode_Curve, which must remain valid while the driver exists
+	                                 //Set to nullptr to use the default curve
+
+} QAD_EncoderSoft_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//---------------
+//QAD_EncoderSoft
+//
+//Driver class for decoding a rotary encoder's quadrature signal in software, using an external interrupt on each of its two pins
+//
+//This allows encoders to be used without each taking a whole timer peripheral, such as for a user interface panel with several encoders.
+//Both pins interrupt on both edges, and each interrupt reads the two pin states and looks up the change in count from a 16 entry table
+//indexed by the previous and current states. Invalid transitions (both pins changing together) and contact bounce that returns to the
+//previous state add nothing, so no debounce filtering is required at user interface rotation speeds.
+//
+//The control methods match those of QAD_Encoder, so the two drivers can be used interchangeably by user interface code.
+//
+//Edges of both pins are routed to the driver by QAD_EXTIMgr, so no IRQ handler function needs to be written for the driver
+class QAD_EncoderSoft {
+private:
+
+	//Quadrature state transition table, indexed by (previous state << 2) | current state, where each state is (Ch2 << 1) | Ch1
+	static constexpr int8_t m_iTransitions[16] = {
+		 0,  1, -1,  0,
+		-1,  0,  0,  1,
+		 1,  0,  0, -1,
+		 0, -1,  1,  0
+	};
+
+	GPIO_TypeDef*      m_pCh1_GPIO;       //GPIO port to be used for channel 1 of the encoder's quadrature signal
+	uint16_t           m_uCh1_Pin;        //Pin number to be used for channel 1 of the encoder's quadrature signal
+
+	GPIO_TypeDef*      m_pCh2_GPIO;       //GPIO port to be used for channel 2 of the encoder's quadrature signal
+	uint16_t           m_uCh2_Pin;        //Pin number to be used for channel 2 of the encoder's quadrature signal
+
+	QAD_GPIO_PullMode  m_ePull;           //Pull-up or pull-down resistors to be used on both pins
+
+	std::unique_ptr<QAD_EXTI> m_pCh1_EXTI;  //External interrupt driver for channel 1
+	std::unique_ptr<QAD_EXTI> m_pCh2_EXTI;  //External interrupt driver for channel 2
+
+	QA_InitState       m_eInitState;      //Stores whether the driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+	QA_ActiveState     m_eState;          //Stores whether the driver is currently active. Member of QA_ActiveState enum defined in setup.hpp
+
+	uint8_t            m_uPrevState;      //Quadrature state at the previous edge
+	volatile int64_t   m_iCount;          //Quadrature count, changed by +/- 1 at each valid edge. Read with interrupts disabled as it is 64bit
+
+	int32_t            m_iCountOld;       //Stores the low 32bits of the quadrature count at the previous call to update()
+	int16_t            m_iValue;          //Stores the change in count not yet returned by getValue()
+	uint16_t           m_uAccel;          //Stores the acceleration value of the encoder (how fast the encoder is being rotated)
+
+	QAD_EncoderMode    m_eMode;           //Stores whether the encoder data output is in linear, exponential or curve mode
+	const QAD_Encoder_Curve* m_pCurve;    //Acceleration curve used by QAD_EncoderMode_Curve
+	int16_t            m_iCurveFrac;      //Fractional part of the scaled value carried between calls to getValue() in curve mode
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+  QAD_EncoderSoft() = delete;                            //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+  QAD_EncoderSoft(QAD_EncoderSoft_InitStruct& sInit) :  //The class constructor to be used, which has a reference to an initialization structure passed to it
+  	m_pCh1_GPIO(sInit.pCh1_GPIO),
+		m_uCh1_Pin(sInit.uCh1_Pin),
+		m_pCh2_GPIO(sInit.pCh2_GPIO),
+		m_uCh2_Pin(sInit.uCh2_Pin),
+		m_ePull(sInit.ePull),
+		m_pCh1_EXTI(nullptr),
+		m_pCh2_EXTI(nullptr),
+		m_eInitState(QA_NotInitialized),
+		m_eState(QA_Inactive),
+		m_uPrevState(0),
+		m_iCount(0),
+		m_iCountOld(0),
+		m_iValue(0),
+		m_uAccel(0),
+		m_eMode(sInit.eMode),
+		m_pCurve((sInit.pCurve) ? sInit.pCurve : QAD_Encoder::getDefaultCurve()),
+		m_iCurveFrac(0) {};
+
+  ~QAD_EncoderSoft() {   //Destructor to make sure external interrupts are disabled and driver is deinitialized upon class destruction
+
+  	//Stop encoder driver if currently active
+  	if (m_eState)
+  		stop();
+
+  	//Deinitialize encoder driver if currently initialized
+  	if (m_eInitState)
+  		deinit();
+  }
+
+
+  //NOTE: See QAD_EncoderSoft.cpp for details of the following functions
+
+  //----------------------
+  //Initialization Methods
+
+  QA_Result init(void);
+  void deinit(void);
+
+
+  //---------------
+  //Control Methods
+
+  QA_Result start(void);
+  void stop(void);
+
+  void update(uint32_t uTicks);
+
+  QA_ActiveState getState(void);
+  int16_t getValue(void);
+  uint16_t getAccel(void);
+
+  void setMode(QAD_EncoderMode eMode);
+  QAD_EncoderMode getMode(void);
+
+  void setCurve(const QAD_Encoder_Curve* pCurve);
+
+
+  //----------------
+  //Position Methods
+
+  int32_t getPosition(void);
+  int64_t getPosition64(void);
+  void setPosition(int64_t iPosition);
+
+private:
+
+  //------------
+  //Tool Methods
+
+  //Returns the current quadrature state, being (Ch2 << 1) | Ch1
+  uint8_t readState(void) {
+  	return ((m_pCh1_GPIO->IDR & m_uCh1_Pin) ? 1 : 0) | ((m_pCh2_GPIO->IDR & m_uCh2_Pin) ? 2 : 0);
+  }
+
+  void edge(void* pData);
+  void decode(void);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_ENCODERSOFT_HPP_ */
@@ -184,5 +184,130 @@ protected:
 };
 
 
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------
+//QAD_Pin
+//
+//Static template class
+//Driver to allow use of a GPIO pin that is fixed at compile time, such as the user LED, bit-banged protocols and timing instrumentation pins
+//
+//The port and pin are template parameters rather than members, so the register addresses are constants and each of on(), off() and
+//read() compiles to a single store to BSRR/BRR or load from IDR, with no function call and no object storage. toggle() reads ODR and
+//writes the result with a single store to BSRR, so other pins of the port are never affected even if they are changed by an interrupt.
+//As the class is static no instance is created, and a pin is normally given a name with a typedef, for example:
+//  typedef QAD_Pin<GPIOC_BASE, GPIO_PIN_13> GPIO_UserLED;
+//  GPIO_UserLED::initOutput(QAD_GPIO_OutputMode_PushPull, QAD_GPIO_PullMode_NoPull, QAD_GPIO_Speed_Low);
+//  GPIO_UserLED::toggle();
+//
+//The QAD_GPIO_Output and QAD_GPIO_Input driver classes remain available for pins that are only known at runtime
+//uPort - Base address of the GPIO port (GPIOx_BASE as defined in stm32f103x6.h), as a pointer cannot be used as a template parameter
+//uPin  - The pin number. A member of GPIO_pins_define as defined in stm32f1xx_hal_gpio.h
+template <uint32_t uPort, uint16_t uPin>
+class QAD_Pin {
+public:
+
+	//Compile time check that a single pin has been selected
+	static_assert((uPin) && !(uPin & (uPin - 1)), "QAD_Pin requires a single GPIO_PIN_x value");
+
+	//--------------------------------------------------------------------
+	//Delete constructors and assignment operator due to being a static class
+	QAD_Pin() = delete;
+	QAD_Pin(const QAD_Pin& other) = delete;
+	QAD_Pin& operator=(const QAD_Pin& other) = delete;
+
+
+	//----------------------
+	//Initialization Methods
+
+	//Used to initialize the pin as an output
+	//The pin is set to its initial state before being changed to an output, so it never outputs an undefined level
+	//eMode   - Selects if pin is to be used in push/pull or open drain mode. A member of QAD_GPIO_OutputMode
+	//ePull   - Selects if pull up or pull down resistor is to be used. A member of QAD_GPIO_PullMode
+	//eSpeed  - Selects the speed the pin is to be used in. A member of QAD_GPIO_Speed
+	//eState  - Initial state of the pin. A member of QAD_GPIO_PinState
+	static void initOutput(QAD_GPIO_OutputMode eMode, QAD_GPIO_PullMode ePull, QAD_GPIO_Speed eSpeed,
+			                   QAD_GPIO_PinState eState = QAD_GPIO_PinState_Off) {
+		set(eState);
+
+		GPIO_InitTypeDef GPIO_Init = {0};
+		GPIO_Init.Pin   = uPin;
+		GPIO_Init.Mode  = (eMode == QAD_GPIO_OutputMode_OpenDrain) ? GPIO_MODE_OUTPUT_OD : GPIO_MODE_OUTPUT_PP;
+		GPIO_Init.Pull  = ePull;
+		GPIO_Init.Speed = eSpeed;
+		HAL_GPIO_Init(getGPIO(), &GPIO_Init);
+	}
+
+	//Used to initialize the pin as an input
+	//ePull - Selects if pull up or pull down resistor is to be used. A member of QAD_GPIO_PullMode
+	static void initInput(QAD_GPIO_PullMode ePull) {
+		GPIO_InitTypeDef GPIO_Init = {0};
+		GPIO_Init.Pin   = uPin;
+		GPIO_Init.Mode  = GPIO_MODE_INPUT;
+		GPIO_Init.Pull  = ePull;
+		HAL_GPIO_Init(getGPIO(), &GPIO_Init);
+	}
+
+	//Used to deinitialize the pin, returning it to its reset state
+	static void deinit(void) {
+		HAL_GPIO_DeInit(getGPIO(), uPin);
+	}
+
+
+	//---------------
+	//Control Methods
+
+	//Used to turn the pin on with a single store to BSRR
+	static void on(void) {
+		getGPIO()->BSRR = uPin;
+	}
+
+	//Used to turn the pin off with a single store to BRR
+	static void off(void) {
+		getGPIO()->BRR = uPin;
+	}
+
+	//Used to set the state of the pin with a single store to BSRR
+	//eState - The new state. A member of QAD_GPIO_PinState
+	static void set(QAD_GPIO_PinState eState) {
+		getGPIO()->BSRR = (eState) ? (uint32_t)uPin : ((uint32_t)uPin << 16);
+	}
+
+	//Used to toggle the state of the pin. The output data register is read and the inverted state written with a single store to BSRR
+	static void toggle(void) {
+		uint32_t uODR = getGPIO()->ODR;
+		getGPIO()->BSRR = ((uODR & uPin) << 16) | (~uODR & uPin);
+	}
+
+	//Returns the level of the pin read with a single load from IDR. A member of QAD_GPIO_PinState
+	static QAD_GPIO_PinState read(void) {
+		return (getGPIO()->IDR & uPin) ? QAD_GPIO_PinState_On : QAD_GPIO_PinState_Off;
+	}
+
+	//Returns the state currently being output, read from the output data register. A member of QAD_GPIO_PinState
+	static QAD_GPIO_PinState getState(void) {
+		return (getGPIO()->ODR & uPin) ? QAD_GPIO_PinState_On : QAD_GPIO_PinState_Off;
+	}
+
+
+	//------------
+	//Data Methods
+
+	//Returns the GPIO port of the pin
+	static GPIO_TypeDef* getGPIO(void) {
+		return reinterpret_cast<GPIO_TypeDef*>(uPort);
+	}
+
+	//Returns the pin number of the pin. A member of GPIO_pins_define as defined in stm32f1xx_hal_gpio.h
+	static constexpr uint16_t getPin(void) {
+		return uPin;
+	}
+
+};
+
+
 //Prevent Recrusive Inclusion
 #endif /* __QAD_GPIO_HPP_ */
@@ -0,0 +1,463 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Port-Parallel GPIO Bus Driver                                   */
+/*   Filename: QAD_GPIO_Bus.cpp                                            */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_GPIO_Bus.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+  //-----------------------------------
+  //-----------------------------------
+  //QAD_GPIO_Bus Initialization Methods
+
+//QAD_GPIO_Bus::init
+//QAD_GPIO_Bus Initialization Method
+//
+//Used to initialize the bus driver
+//Returns QA_OK if initialization successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
+//        QA_Fail if the GPIO port or pin mask is invalid, or the pattern rate cannot be produced by the selected timer
+//        QA_Error_PeriphBusy if patterns are enabled and either the timer or its update DMA channel is already in use
+QA_Result QAD_GPIO_Bus::init(void) {
+
+	//Return if already initialized
+	if (m_eInitState)
+		return QA_OK;
+
+	//Check that a GPIO port is set and that the pins of the bus form a contiguous range
+	uint32_t uBits = (uint32_t)m_uMask >> m_uShift;
+	if ((!m_pGPIO) || (!m_uMask) || (uBits & (uBits + 1)))
+		return QA_Fail;
+
+	//If patterns are enabled then claim the timer and its update DMA channel
+	if (m_ePattern) {
+		if ((m_eTimer >= QAD_TimerNone) || (!m_uPeriod))
+			return QA_Fail;
+
+		QA_Result eRes = QAD_TimerMgr::registerTimer(m_eTimer, QAD_Timer_InUse_GPIOBus);
+		if (eRes)
+			return eRes;
+
+		m_ePatternDMA = QAD_TimerMgr::getDMAChannelUpdate(m_eTimer);
+		if (QAD_DMAMgr::registerChannel(m_ePatternDMA)) {
+			QAD_TimerMgr::deregisterTimer(m_eTimer);
+			return QA_Error_PeriphBusy;
+		}
+	}
+
+	//Initialize GPIOs and pattern peripherals
+	QA_Result eRes = periphInit();
+
+	//If initialization failed then deregister the Timer peripheral and DMA channel
+	if ((eRes) && (m_ePattern)) {
+		QAD_TimerMgr::deregisterTimer(m_eTimer);
+		QAD_DMAMgr::deregisterChannel(m_ePatternDMA);
+	}
+
+	//Return initialization result
+	return eRes;
+}
+
+
+//QAD_GPIO_Bus::deinit
+//QAD_GPIO_Bus Initialization Method
+//
+//Used to deinitialize the bus driver
+void QAD_GPIO_Bus::deinit(void) {
+
+	//Return if driver is not currently initialized
+	if (!m_eInitState)
+		return;
+
+	//Deinitialize driver
+	periphDeinit(DeinitFull);
+
+	//Deregister Timer peripheral and DMA channel
+	if (m_ePattern) {
+		QAD_TimerMgr::deregisterTimer(m_eTimer);
+		QAD_DMAMgr::deregisterChannel(m_ePatternDMA);
+	}
+}
+
+
+  //--------------------------------
+  //--------------------------------
+  //QAD_GPIO_Bus IRQ Handler Methods
+
+//QAD_GPIO_Bus::handler
+//QAD_GPIO_Bus IRQ Handler Method
+//
+//To be called from the IRQ handler function of the timer's update DMA channel in handlers.cpp
+//Calls the pattern callback delegate as each half of the buffer is completed in circular mode, or when the whole buffer has been
+//completed in single mode, in which case the pattern is also stopped
+void QAD_GPIO_Bus::handler(void) {
+	uint8_t uEvents = QAD_DMAMgr::getBufferEvents(&m_sDMA);
+	QAD_GPIO_Bus_PatternBlock sBlock;
+
+	//Half Transfer
+	if (uEvents & QAD_DMA_Event_Half) {
+		sBlock.eEvent = QAD_GPIO_Bus_Pattern_HalfFirst;
+		sBlock.pWords = m_pPatternBuffer;
+		sBlock.uCount = m_uPatternCount / 2;
+		m_sPatternHandler(&sBlock);
+	}
+
+	//Transfer Complete
+	if (uEvents & QAD_DMA_Event_Complete) {
+		if (m_ePatternMode == QAD_GPIO_Bus_PatternCircular) {
+			sBlock.eEvent = QAD_GPIO_Bus_Pattern_HalfSecond;
+			sBlock.pWords = m_pPatternBuffer + (m_uPatternCount / 2);
+			sBlock.uCount = m_uPatternCount / 2;
+		} else {
+			stopPattern();
+			sBlock.eEvent = QAD_GPIO_Bus_Pattern_Complete;
+			sBlock.pWords = m_pPatternBuffer;
+			sBlock.uCount = m_uPatternCount;
+		}
+		m_sPatternHandler(&sBlock);
+	}
+}
+
+
+  //----------------------------
+  //----------------------------
+  //QAD_GPIO_Bus Control Methods
+
+//QAD_GPIO_Bus::setDirection
+//QAD_GPIO_Bus Control Method
+//
+//Used to change the direction of the bus, such as for the data bus of a parallel LCD that is both written and read
+//When changing back to output mode the bus outputs the word that was being output when it was changed to input mode
+//eDirection - Member of QAD_GPIO_Bus_Direction
+void QAD_GPIO_Bus::setDirection(QAD_GPIO_Bus_Direction eDirection) {
+
+	//Return if direction is unchanged, or a pattern is active
+	if ((eDirection == m_eDirection) || (m_ePatternState))
+		return;
+
+	m_eDirection = eDirection;
+	if (m_eInitState)
+		initPins();
+}
+
+
+//QAD_GPIO_Bus::getDirection
+//QAD_GPIO_Bus Control Method
+//
+//Returns the current direction of the bus. Member of QAD_GPIO_Bus_Direction
+QAD_GPIO_Bus_Direction QAD_GPIO_Bus::getDirection(void) {
+	return m_eDirection;
+}
+
+
+  //----------------------------
+  //----------------------------
+  //QAD_GPIO_Bus Pattern Methods
+
+//QAD_GPIO_Bus::fillPattern
+//QAD_GPIO_Bus Pattern Method
+//
+//Used to convert a buffer of bus words into BSRR words to be output by startPattern(), such as to refill half of a circular pattern
+//pBuffer - Buffer of BSRR words to be written
+//pWords  - Buffer of bus words to be converted
+//uCount  - Number of words to be converted
+void QAD_GPIO_Bus::fillPattern(uint32_t* pBuffer, const uint16_t* pWords, uint32_t uCount) {
+	for (uint32_t i=0; i<uCount; i++)
+		pBuffer[i] = getBSRR(pWords[i]);
+}
+
+
+//QAD_GPIO_Bus::setPatternHandler
+//QAD_GPIO_Bus Pattern Method
+//
+//Used to set the callback delegate to be called as parts of the pattern buffer are completed
+//The delegate's event data (pData) is a pointer to a QAD_GPIO_Bus_PatternBlock structure
+//sHandler - The callback delegate (QAT_Delegate defined in QAT_Delegate.hpp)
+void QAD_GPIO_Bus::setPatternHandler(const QAT_Delegate& sHandler) {
+	m_sPatternHandler = sHandler;
+}
+
+
+//QAD_GPIO_Bus::setPatternRate
+//QAD_GPIO_Bus Pattern Method
+//
+//Used to set the rate at which pattern words are output, with the prescaler and period being found by QAD_TimerMgr::calcFrequency()
+//uRate - The required rate in Hz. Use getPatternRate() to retrieve the rate actually achieved
+//Returns QA_OK if successful
+//        QA_Error_PeriphBusy if a pattern is currently active
+//        QA_Fail if the rate cannot be produced by the selected timer
+QA_Result QAD_GPIO_Bus::setPatternRate(uint32_t uRate) {
+
+	//Check pattern state and timer
+	if (m_ePatternState)
+		return QA_Error_PeriphBusy;
+
+	if (m_eTimer >= QAD_TimerNone)
+		return QA_Fail;
+
+	//Find prescaler and period for the required rate
+	QAD_Timer_FreqConfig sConfig = QAD_TimerMgr::calcFrequency(m_eTimer, uRate, 2);
+	if (!sConfig.bValid)
+		return QA_Fail;
+
+	m_uPrescaler = sConfig.uPrescaler;
+	m_uPeriod    = sConfig.uPeriod;
+
+	//If driver is initialized then load the new prescaler and period. The update DMA request is disabled while no pattern is active,
+	//so the update event generated here does not transfer a word
+	if ((m_eInitState) && (m_ePattern)) {
+		m_sHandle.Init.Prescaler  = m_uPrescaler;
+		m_sHandle.Init.Period     = m_uPeriod;
+		m_sHandle.Instance->PSC   = m_uPrescaler;
+		m_sHandle.Instance->ARR   = m_uPeriod;
+		m_sHandle.Instance->EGR   = TIM_EGR_UG;
+		m_sHandle.Instance->SR    = 0;
+	}
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_GPIO_Bus::getPatternRate
+//QAD_GPIO_Bus Pattern Method
+//
+//Returns the rate in Hz at which pattern words are output, rounded to the nearest Hz, or 0 if patterns are not enabled
+uint32_t QAD_GPIO_Bus::getPatternRate(void) {
+	if ((!m_ePattern) || (!m_uPeriod))
+		return 0;
+	return QAD_TimerMgr::getFrequency(m_eTimer, m_uPrescaler, m_uPeriod);
+}
+
+
+//QAD_GPIO_Bus::startPattern
+//QAD_GPIO_Bus Pattern Method
+//
+//Used to start outputting a pattern, with one BSRR word being written to the port on each timer update event
+//The first word is output immediately, with each following word being output one pattern period after the previous one
+//pBuffer - Buffer of BSRR words (see getBSRR(), calcBSRR() and fillPattern()), which can be held in flash. The buffer must remain valid
+//          until the pattern is stopped or completed
+//uCount  - Number of words in the buffer (maximum of 65535). Must be even in circular mode, so that the buffer divides into two halves
+//eMode   - Member of QAD_GPIO_Bus_PatternMode to select whether the buffer is output once or continuously
+//Returns QA_OK if successful
+//        QA_Error_PeriphNotSupported if patterns were not enabled in the initialization structure, or the bus is in input mode
+//        QA_Error_PeriphBusy if a pattern is already active
+//        QA_Fail if the driver is not initialized, or the buffer is invalid
+QA_Result QAD_GPIO_Bus::startPattern(const uint32_t* pBuffer, uint32_t uCount, QAD_GPIO_Bus_PatternMode eMode) {
+
+	//Check driver state
+	if (!m_eInitState)
+		return QA_Fail;
+
+	if ((!m_ePattern) || (m_eDirection != QAD_GPIO_Bus_Output))
+		return QA_Error_PeriphNotSupported;
+
+	if (m_ePatternState)
+		return QA_Error_PeriphBusy;
+
+	//Check buffer, as DMA transfer count is limited to 16bits
+	if ((!pBuffer) || (!uCount) || (uCount > 0xFFFF) || ((eMode == QAD_GPIO_Bus_PatternCircular) && (uCount & 0x01)))
+		return QA_Fail;
+
+	//Store pattern details
+	m_ePatternMode   = eMode;
+	m_pPatternBuffer = pBuffer;
+	m_uPatternCount  = uCount;
+
+	//Set DMA mode
+	m_sDMA.Init.Mode = (eMode == QAD_GPIO_Bus_PatternCircular) ? DMA_CIRCULAR : DMA_NORMAL;
+	if (eMode == QAD_GPIO_Bus_PatternCircular)
+		SET_BIT(m_sDMA.Instance->CCR, DMA_CCR_CIRC);
+	else
+		CLEAR_BIT(m_sDMA.Instance->CCR, DMA_CCR_CIRC);
+
+	//Start DMA transfer from buffer to the port's BSRR register, with half transfer interrupt only being required in circular mode
+	HAL_DMA_Start(&m_sDMA, (uint32_t)pBuffer, (uint32_t)&m_pGPIO->BSRR, uCount);
+	__HAL_DMA_ENABLE_IT(&m_sDMA, (eMode == QAD_GPIO_Bus_PatternCircular) ? (DMA_IT_HT | DMA_IT_TC) : DMA_IT_TC);
+	HAL_NVIC_EnableIRQ(QAD_DMAMgr::getIRQ(m_ePatternDMA));
+
+	//Set pattern state to active before the first transfer, as a single word pattern completes immediately
+	m_ePatternState = QA_Active;
+
+	//Enable timer update DMA request, then generate an update event to reset the counter and output the first word, and start the timer
+	__HAL_TIM_ENABLE_DMA(&m_sHandle, TIM_DMA_UPDATE);
+	m_sHandle.Instance->EGR = TIM_EGR_UG;
+	__HAL_TIM_ENABLE(&m_sHandle);
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_GPIO_Bus::stopPattern
+//QAD_GPIO_Bus Pattern Method
+//
+//Used to stop the current pattern. The word most recently output continues to be output
+void QAD_GPIO_Bus::stopPattern(void) {
+
+	//Return if no pattern is active
+	if (!m_ePatternState)
+		return;
+
+	//Stop timer and disable timer update DMA request
+	__HAL_TIM_DISABLE(&m_sHandle);
+	__HAL_TIM_DISABLE_DMA(&m_sHandle, TIM_DMA_UPDATE);
+
+	//Stop DMA transfer
+	HAL_NVIC_DisableIRQ(QAD_DMAMgr::getIRQ(m_ePatternDMA));
+	HAL_DMA_Abort(&m_sDMA);
+
+	//Set pattern state to inactive
+	m_ePatternState = QA_Inactive;
+}
+
+
+//QAD_GPIO_Bus::getPatternState
+//QAD_GPIO_Bus Pattern Method
+//
+//Returns QA_Active if a pattern is currently active, or QA_Inactive if not
+QA_ActiveState QAD_GPIO_Bus::getPatternState(void) {
+	return m_ePatternState;
+}
+
+
+  //-------------------------------------------
+  //-------------------------------------------
+  //QAD_GPIO_Bus Private Initialization Methods
+
+//QAD_GPIO_Bus::periphInit
+//QAD_GPIO_Bus Private Initialization Method
+//
+//Used to initialize the GPIOs of the bus, and when patterns are enabled the timer peripheral clock, timer peripheral and DMA channel
+//In the case of a failed initialization, a partial deinitialization will be performed to make sure the peripherals and clock
+//are all in the uninitialized state
+//Returns QA_OK if successful, or QA_Fail if initialization fails
+QA_Result QAD_GPIO_Bus::periphInit(void) {
+
+	//Init GPIOs, with the initial word being set before the pins are changed to outputs
+	initPins();
+
+	//Init pattern timer and DMA channel
+	if (m_ePattern) {
+
+		//Enable Timer Clock
+		QAD_TimerMgr::enableClock(m_eTimer);
+
+		//Initialize timer with one update event per pattern word. The timer is only started while a pattern is active
+		m_sHandle.Instance               = QAD_TimerMgr::getInstance(m_eTimer);  //Set instance for Timer peripheral
+		m_sHandle.Init.Prescaler         = m_uPrescaler;                         //Set prescaler found for pattern rate
+		m_sHandle.Init.CounterMode       = TIM_COUNTERMODE_UP;                   //Set timer counter mode to count up
+		m_sHandle.Init.Period            = m_uPeriod;                            //Set timer counter period found for pattern rate
+		m_sHandle.Init.ClockDivision     = TIM_CLOCKDIVISION_DIV1;               //Unused
+		m_sHandle.Init.RepetitionCounter = 0x0;                                  //
+		m_sHandle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;       //Period is only changed while the timer is stopped
+
+		if (HAL_TIM_Base_Init(&m_sHandle) != HAL_OK) {
+			periphDeinit(DeinitPartial);
+			return QA_Fail;
+		}
+
+		//Init Pattern DMA Channel
+		m_sDMA.Instance                 = QAD_DMAMgr::getInstance(m_ePatternDMA);  //Set instance for DMA channel
+		m_sDMA.Init.Direction           = DMA_MEMORY_TO_PERIPH;                    //Transfer from buffer to the port's BSRR register
+		m_sDMA.Init.PeriphInc           = DMA_PINC_DISABLE;                        //BSRR register address is fixed
+		m_sDMA.Init.MemInc              = DMA_MINC_ENABLE;                         //Increment through buffer
+		m_sDMA.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;                     //32bit BSRR register, so set and reset happen in one write
+		m_sDMA.Init.MemDataAlignment    = DMA_MDATAALIGN_WORD;                     //32bit buffer entries
+		m_sDMA.Init.Mode                = DMA_NORMAL;                              //Mode is set when each pattern is started
+		m_sDMA.Init.Priority            = DMA_PRIORITY_HIGH;                       //
+
+		if (HAL_DMA_Init(&m_sDMA) != HAL_OK) {
+			HAL_TIM_Base_DeInit(&m_sHandle);
+			periphDeinit(DeinitPartial);
+			return QA_Fail;
+		}
+
+		//Set DMA IRQ priority. IRQ is enabled in startPattern()
+		HAL_NVIC_SetPriority(QAD_DMAMgr::getIRQ(m_ePatternDMA), m_uPatternIRQPriority, 0x00);
+	}
+
+	//Set driver state as initialized
+	m_eInitState = QA_Initialized;
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_GPIO_Bus::periphDeinit
+//QAD_GPIO_Bus Private Initialization Method
+//
+//Used to deinitialize the GPIOs of the bus, and when patterns are enabled the timer peripheral clock, timer peripheral and DMA channel
+//eDeinitMode - Set to DeinitPartial to perform a partial deinitialization (only to be used by periphInit() method
+//              in a case where peripheral initialization has failed
+//            - Set to DeinitFull to perform a full deinitialization in a case where the driver is fully initialized
+void QAD_GPIO_Bus::periphDeinit(QAD_GPIO_Bus::DeinitMode eDeinitMode) {
+
+	if (m_ePattern) {
+
+		//Check if a full deinitialization is required
+		if (eDeinitMode) {
+
+			//Stop any active pattern and deinitialize DMA channel
+			stopPattern();
+			HAL_DMA_DeInit(&m_sDMA);
+			m_sDMA.Instance = NULL;
+
+			//Deinitialize Timer Peripheral
+			HAL_TIM_Base_DeInit(&m_sHandle);
+		}
+
+		//Disable Timer Clock
+		QAD_TimerMgr::disableClock(m_eTimer);
+	}
+
+	//Deinitialize GPIOs
+	HAL_GPIO_DeInit(m_pGPIO, m_uMask);
+
+	//Set driver state as not initialized
+	m_eInitState = QA_NotInitialized;
+}
+
+
+//QAD_GPIO_Bus::initPins
+//QAD_GPIO_Bus Private Initialization Method
+//
+//Used to configure all pins of the bus for the current direction with a single call to HAL_GPIO_Init()
+//In input mode the output data register selects the direction of the pull resistors, so the output word is saved when changing to
+//input mode, and is set before the pins are changed back to outputs so that the bus never shows an undefined value
+void QAD_GPIO_Bus::initPins(void) {
+	GPIO_InitTypeDef GPIO_Init = {0};
+	GPIO_Init.Pin = m_uMask;
+
+	if (m_eDirection == QAD_GPIO_Bus_Output) {
+		m_pGPIO->BSRR   = getBSRR(m_uInitial);
+		GPIO_Init.Mode  = (m_eOutputMode == QAD_GPIO_OutputMode_OpenDrain) ? GPIO_MODE_OUTPUT_OD : GPIO_MODE_OUTPUT_PP;
+		GPIO_Init.Pull  = GPIO_NOPULL;
+		GPIO_Init.Speed = m_eSpeed;
+	} else {
+		if (m_eInitState)
+			m_uInitial    = getOutput();
+		GPIO_Init.Mode  = GPIO_MODE_INPUT;
+		GPIO_Init.Pull  = m_ePullMode;
+	}
+
+	HAL_GPIO_Init(m_pGPIO, &GPIO_Init);
+}
@@ -0,0 +1,309 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Port-Parallel GPIO Bus Driver                                   */
+/*   Filename: QAD_GPIO_Bus.hpp                                            */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_GPIO_BUS_HPP_
+#define __QAD_GPIO_BUS_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_GPIO.hpp"
+#include "QAD_TimerMgr.hpp"
+#include "QAD_DMAMgr.hpp"
+#include "QAT_Delegate.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------------
+//QAD_GPIO_Bus_Direction
+//
+//Used to select whether the pins of a bus are outputs or inputs
+enum QAD_GPIO_Bus_Direction : uint8_t {
+	QAD_GPIO_Bus_Output = 0,   //Pins are outputs, set using the output mode and speed of the initialization structure
+	QAD_GPIO_Bus_Input         //Pins are inputs, using the pull mode of the initialization structure
+};
+
+
+//------------------------
+//QAD_GPIO_Bus_PatternMode
+//
+//Enum used to select how the buffer passed to QAD_GPIO_Bus::startPattern() is output
+enum QAD_GPIO_Bus_PatternMode : uint8_t {
+	QAD_GPIO_Bus_PatternSingle = 0,  //Buffer is output once, after which the final word continues to be output
+	QAD_GPIO_Bus_PatternCircular     //Buffer is output continuously, with a callback as each half is completed so that it can be refilled
+};
+
+
+//-------------------------
+//QAD_GPIO_Bus_PatternEvent
+//
+//Used to indicate which part of the pattern buffer has been completed when the pattern callback is called
+enum QAD_GPIO_Bus_PatternEvent : uint8_t {
+	QAD_GPIO_Bus_Pattern_HalfFirst = 0,  //Circular mode - First half of the buffer has been output and can be refilled
+	QAD_GPIO_Bus_Pattern_HalfSecond,     //Circular mode - Second half of the buffer has been output and can be refilled
+	QAD_GPIO_Bus_Pattern_Complete        //Single mode - The whole buffer has been output and the pattern has stopped
+};
+
+
+//-------------------------
+//QAD_GPIO_Bus_PatternBlock
+//
+//Structure passed as the pData parameter of the pattern callback each time part of the pattern buffer has been completed
+typedef struct {
+
+	QAD_GPIO_Bus_PatternEvent eEvent;  //Which part of the buffer has been completed. Member of QAD_GPIO_Bus_PatternEvent
+
+	const uint32_t*   pWords;          //Pointer to the completed part of the pattern buffer
+	uint32_t          uCount;          //Number of words in the completed part of the buffer
+
+} QAD_GPIO_Bus_PatternBlock;
+
+
+//-----------------------
+//QAD_GPIO_Bus_InitStruct
+//
+//This structure is used to be able to create the QAD_GPIO_Bus driver class
+typedef struct {
+
+	GPIO_TypeDef*       pGPIO;          //GPIO port of the bus
+	uint16_t            uMask;          //Mask of the pins of the bus (GPIO_PIN_x values combined together), which must be a contiguous range
+	                                    //Bit 0 of each bus word maps to the lowest pin of the mask
+
+	QAD_GPIO_Bus_Direction eDirection;  //Initial direction of the bus. Member of QAD_GPIO_Bus_Direction
+	QAD_GPIO_OutputMode eOutputMode;    //Push/Pull or Open Drain output mode. Member of QAD_GPIO_OutputMode as defined in QAD_GPIO.hpp
+	QAD_GPIO_PullMode   ePullMode;      //Pull resistors used in input mode. Member of QAD_GPIO_PullMode as defined in QAD_GPIO.hpp
+	QAD_GPIO_Speed      eSpeed;         //Output speed. Member of QAD_GPIO_Speed as defined in QAD_GPIO.hpp
+	uint16_t            uInitial;       //Bus word output when the pins are first set as outputs, so the bus never shows an undefined value
+
+	QA_ActiveState      ePattern;       //Set to QA_Active to allow patterns to be output by DMA using startPattern()
+	                                    //This claims the timer and its update DMA channel (see QAD_TimerMgr.hpp) when the driver is initialized
+	QAD_Timer_Periph    eTimer;         //Timer peripheral used to pace the pattern. Member of QAD_Timer_Periph as defined in QAD_TimerMgr.hpp
+	uint32_t            uPatternRate;   //Rate in Hz at which pattern words are output
+	uint8_t             uPatternIRQPriority;  //IRQ Priority for the pattern DMA interrupt (a value between 0 and 15)
+
+} QAD_GPIO_Bus_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//------------
+//QAD_GPIO_Bus
+//
+//Driver class used to access a group of pins on a single GPIO port as one parallel bus, such as the data bus of a parallel LCD or a
+//resistor ladder DAC
+//
+//Each write is a single store to the port's bit set/reset register (BSRR), with the set bits in the lower half-word and the reset bits
+//in the upper half-word, so all pins of the bus change on the same clock cycle and pins of the port outside the bus are never affected.
+//No read-modify-write of the output data register is performed, so the bus can be written while interrupts drive other pins of the same
+//port. Each read is a single load of the input data register (IDR), so all pins are sampled together.
+//
+//When patterns are enabled, a buffer of BSRR words is written to the port by the update DMA request of a timer, so a word is output at a
+//fixed rate with no CPU involvement and no jitter from interrupts. getBSRR() and fillPattern() convert bus words to BSRR words, and
+//calcBSRR() can be used to build constant pattern tables at compile time. The handler() method is to be called by the IRQ handler function
+//of the timer's update DMA channel within handlers.cpp
+class QAD_GPIO_Bus {
+private:
+
+	//Deinitialization mode to be used by periphDeinit() method
+	enum DeinitMode : uint8_t {
+		DeinitPartial = 0,    //Only to be used for partial deinitialization upon initialization failure in periphInit() method
+		DeinitFull            //Used for full driver deinitialization when driver is in a fully initialized state
+	};
+
+	QA_InitState        m_eInitState;    //Stores whether the driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+
+	GPIO_TypeDef*       m_pGPIO;         //GPIO port of the bus
+	uint16_t            m_uMask;         //Mask of the pins of the bus
+	uint8_t             m_uShift;        //Pin number of the lowest pin of the bus, which bit 0 of each bus word maps to
+
+	QAD_GPIO_Bus_Direction m_eDirection; //Current direction of the bus
+	QAD_GPIO_OutputMode m_eOutputMode;   //Push/Pull or Open Drain output mode
+	QAD_GPIO_PullMode   m_ePullMode;     //Pull resistors used in input mode
+	QAD_GPIO_Speed      m_eSpeed;        //Output speed
+	uint16_t            m_uInitial;      //Bus word output when the pins are set as outputs, saved from the output when changing to input mode
+
+	QA_ActiveState      m_ePattern;      //Stores whether DMA patterns are enabled for the driver
+	QAD_Timer_Periph    m_eTimer;        //Timer peripheral used to pace the pattern
+	uint32_t            m_uPrescaler;    //Prescaler used for the pattern timer
+	uint32_t            m_uPeriod;       //Counter period used for the pattern timer, with one pattern word being output per period
+	uint8_t             m_uPatternIRQPriority;  //IRQ Priority for the pattern DMA interrupt
+	QAD_DMA_Channel     m_ePatternDMA;   //DMA channel used for patterns (the timer's update DMA channel)
+
+	TIM_HandleTypeDef   m_sHandle;       //Handle used by HAL functions to access Timer peripheral (defined in stm32f1xx_hal_tim.h)
+	DMA_HandleTypeDef   m_sDMA;          //Handle used by HAL functions to access the DMA channel (defined in stm32f1xx_hal_dma.h)
+
+	QA_ActiveState      m_ePatternState; //Stores whether a pattern is currently active
+	QAD_GPIO_Bus_PatternMode m_ePatternMode;  //Mode of the current pattern. Member of QAD_GPIO_Bus_PatternMode
+	const uint32_t*     m_pPatternBuffer;//Buffer of the current pattern
+	uint32_t            m_uPatternCount; //Number of words in the buffer of the current pattern
+
+	QAT_Delegate        m_sPatternHandler;  //Callback delegate to be called as parts of the pattern buffer are completed (QAT_Delegate defined in QAT_Delegate.hpp)
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+	QAD_GPIO_Bus() = delete;                        //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+	QAD_GPIO_Bus(QAD_GPIO_Bus_InitStruct& sInit) :  //The class constructor to be used, which has a reference to an initialization structure passed to it
+		m_eInitState(QA_NotInitialized),
+		m_pGPIO(sInit.pGPIO),
+		m_uMask(sInit.uMask),
+		m_uShift((sInit.uMask) ? (uint8_t)__CLZ(__RBIT(sInit.uMask)) : 0),
+		m_eDirection(sInit.eDirection),
+		m_eOutputMode(sInit.eOutputMode),
+		m_ePullMode(sInit.ePullMode),
+		m_eSpeed(sInit.eSpeed),
+		m_uInitial(sInit.uInitial),
+		m_ePattern(sInit.ePattern),
+		m_eTimer(sInit.eTimer),
+		m_uPrescaler(0),
+		m_uPeriod(0),
+		m_uPatternIRQPriority(sInit.uPatternIRQPriority),
+		m_ePatternDMA(QAD_DMA_ChannelNone),
+		m_sHandle({0}),
+		m_sDMA({0}),
+		m_ePatternState(QA_Inactive),
+		m_ePatternMode(QAD_GPIO_Bus_PatternSingle),
+		m_pPatternBuffer(NULL),
+		m_uPatternCount(0),
+		m_sPatternHandler() {
+
+		//Find prescaler and period for the pattern rate. If the rate cannot be produced then init() will fail
+		if (m_ePattern)
+			setPatternRate(sInit.uPatternRate);
+	}
+
+	~QAD_GPIO_Bus() {  //Destructor to make sure any pattern is stopped and the driver is deinitialized upon class destruction
+
+		//Deinitialize driver if currently initialized
+		if (m_eInitState)
+			deinit();
+	}
+
+
+	//NOTE: See QAD_GPIO_Bus.cpp for details of the following functions
+
+	//----------------------
+	//Initialization Methods
+
+	QA_Result init(void);
+	void deinit(void);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	void handler(void);
+
+
+	//---------------
+	//Control Methods
+
+	//Used to write a word to the bus with a single store to BSRR, so all pins of the bus change together
+	//Only to be used when the bus is in output mode
+	//uWord - The bus word, with bit 0 output on the lowest pin of the bus
+	void write(uint16_t uWord) {
+		m_pGPIO->BSRR = getBSRR(uWord);
+	}
+
+	//Used to set bits of the bus with a single store to BSRR, leaving the other bits unchanged
+	//uBits - Bus word with the bits to be set
+	void setBits(uint16_t uBits) {
+		m_pGPIO->BSRR = ((uint32_t)uBits << m_uShift) & m_uMask;
+	}
+
+	//Used to clear bits of the bus with a single store to BRR, leaving the other bits unchanged
+	//uBits - Bus word with the bits to be cleared
+	void clearBits(uint16_t uBits) {
+		m_pGPIO->BRR = ((uint32_t)uBits << m_uShift) & m_uMask;
+	}
+
+	//Used to read the bus with a single load of IDR, so all pins of the bus are sampled together
+	//Returns the bus word, with bit 0 read from the lowest pin of the bus
+	uint16_t read(void) {
+		return (uint16_t)((m_pGPIO->IDR & m_uMask) >> m_uShift);
+	}
+
+	//Returns the bus word currently being output, read from the output data register
+	uint16_t getOutput(void) {
+		return (uint16_t)((m_pGPIO->ODR & m_uMask) >> m_uShift);
+	}
+
+	void setDirection(QAD_GPIO_Bus_Direction eDirection);
+	QAD_GPIO_Bus_Direction getDirection(void);
+
+	//Returns the mask of the bus word bits (the pin mask shifted down to bit 0)
+	uint16_t getWordMask(void) {
+		return (uint16_t)(m_uMask >> m_uShift);
+	}
+
+
+	//---------------
+	//Pattern Methods
+
+	//Used to calculate the BSRR word that outputs a bus word, setting pins of the bus for 1 bits and resetting them for 0 bits
+	//As this method is constexpr, it can be used to build constant pattern tables to be held in flash
+	//uMask  - Mask of the pins of the bus
+	//uShift - Pin number of the lowest pin of the bus
+	//uWord  - The bus word
+	static constexpr uint32_t calcBSRR(uint16_t uMask, uint8_t uShift, uint16_t uWord) {
+		return ((((uint32_t)uWord << uShift) & uMask) | (((~((uint32_t)uWord << uShift)) & uMask) << 16));
+	}
+
+	//Returns the BSRR word that outputs a bus word on this bus
+	//uWord - The bus word
+	uint32_t getBSRR(uint16_t uWord) {
+		return calcBSRR(m_uMask, m_uShift, uWord);
+	}
+
+	void fillPattern(uint32_t* pBuffer, const uint16_t* pWords, uint32_t uCount);
+
+	void setPatternHandler(const QAT_Delegate& sHandler);
+
+	QA_Result setPatternRate(uint32_t uRate);
+	uint32_t getPatternRate(void);
+
+	QA_Result startPattern(const uint32_t* pBuffer, uint32_t uCount, QAD_GPIO_Bus_PatternMode eMode);
+	void stopPattern(void);
+
+	QA_ActiveState getPatternState(void);
+
+
+private:
+
+	//------------------------------
+	//Private Initialization Methods
+
+	QA_Result periphInit(void);
+	void periphDeinit(DeinitMode eDeinitMode);
+
+	void initPins(void);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_GPIO_BUS_HPP_ */
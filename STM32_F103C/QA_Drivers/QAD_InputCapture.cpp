@@ -0,0 +1,546 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Input Capture Driver                                            */
+/*   Filename: QAD_InputCapture.cpp                                        */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_InputCapture.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+  //---------------------------------------
+  //---------------------------------------
+  //QAD_InputCapture Initialization Methods
+
+//QAD_InputCapture::init
+//QAD_InputCapture Initialization Method
+//
+//Used to initialize the input capture driver
+//Returns QA_OK if initialization successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
+QA_Result QAD_InputCapture::init(void) {
+
+	//Check if selected Timer peripheral is currently available
+  if (QAD_TimerMgr::getState(m_eTimer))
+  	return QA_Error_PeriphBusy;
+
+  //Register Timer peripheral as now being in use
+  QAD_TimerMgr::registerTimer(m_eTimer, QAD_Timer_InUse_Capture);
+
+  //Initialize the Timer peripheral
+  QA_Result eRes = periphInit();
+
+  //If initialization failed then deregister the Timer peripheral
+  if (eRes)
+  	QAD_TimerMgr::deregisterTimer(m_eTimer);
+
+  //Return initialization result
+  return eRes;
+}
+
+
+//QAD_InputCapture::deinit
+//QAD_InputCapture Initialization Method
+//
+//Used to deinitialize the input capture driver
+void QAD_InputCapture::deinit(void) {
+
+	//Return if input capture driver is not currently initialized
+  if (!m_eInitState)
+  	return;
+
+  //Deinitialize input capture driver
+  periphDeinit(DeinitFull);
+
+  //Deregister Timer peripheral
+  QAD_TimerMgr::deregisterTimer(m_eTimer);
+}
+
+
+  //--------------------------------
+  //--------------------------------
+  //QAD_InputCapture Control Methods
+
+//QAD_InputCapture::start
+//QAD_InputCapture Control Method
+//
+//Starts the input capture driver
+//The DMA transfer for each capture channel is started in circular mode before the capture channels and timer counter are enabled
+void QAD_InputCapture::start(void) {
+
+	//Check if driver is initialized and is currently not active
+	if ((!m_eInitState) || (m_eState))
+		return;
+
+	for (uint8_t i=0; i<QAD_INPUTCAPTURE_CHANNEL_COUNT; i++) {
+		if (m_sCapture[i].eUsed) {
+
+			//Reset ring buffer and results
+			m_sCapture[i].uReadIdx  = 0;
+			m_sCapture[i].uCaptured = 0;
+			m_uPeriodSum[i]         = 0;
+			m_uPeriodCount[i]       = 0;
+			m_uWidthSum[i]          = 0;
+			m_uWidthCount[i]        = 0;
+			m_uSamples[i]           = 0;
+
+			//Start circular DMA transfer from capture register to ring buffer
+			HAL_DMA_Start(&m_sCapture[i].sDMA, (uint32_t)(&m_sHandle.Instance->CCR1 + i), (uint32_t)m_sCapture[i].pBuffer.get(), m_uBufferSize);
+
+			//Enable capture DMA request and capture channel
+			__HAL_TIM_ENABLE_DMA(&m_sHandle, m_uDMASelect[i]);
+			TIM_CCxChannelCmd(m_sHandle.Instance, m_uChannelSelect[i], TIM_CCx_ENABLE);
+		}
+	}
+
+	//Enable timer counter
+	__HAL_TIM_ENABLE(&m_sHandle);
+
+	//Set driver state to active
+	m_eState = QA_Active;
+}
+
+
+//QAD_InputCapture::stop
+//QAD_InputCapture Control Method
+//
+//Stops the input capture driver
+void QAD_InputCapture::stop(void) {
+
+	//Check if driver is initialized and is currently active
+	if ((!m_eInitState) || (!m_eState))
+		return;
+
+	//Disable timer counter
+	__HAL_TIM_DISABLE(&m_sHandle);
+
+	for (uint8_t i=0; i<QAD_INPUTCAPTURE_CHANNEL_COUNT; i++) {
+		if (m_sCapture[i].eUsed) {
+
+			//Disable capture channel and capture DMA request
+			TIM_CCxChannelCmd(m_sHandle.Instance, m_uChannelSelect[i], TIM_CCx_DISABLE);
+			__HAL_TIM_DISABLE_DMA(&m_sHandle, m_uDMASelect[i]);
+
+			//Stop DMA transfer
+			HAL_DMA_Abort(&m_sCapture[i].sDMA);
+		}
+	}
+
+	//Set driver state to inactive
+	m_eState = QA_Inactive;
+}
+
+
+//QAD_InputCapture::process
+//QAD_InputCapture Control Method
+//
+//Processes the timestamps captured since the previous call as a single batch, updating the averaged period, pulse width and duty results
+//This method is to be called regularly from the main processing loop, often enough that less than half of each ring buffer is filled
+//between calls. Only the most recent half of each ring buffer is used, so that timestamps being processed are not overwritten by DMA.
+//If no new edges have been captured for a channel then the results from the previous batch are kept, and getSamples() will return 0
+void QAD_InputCapture::process(void) {
+
+	//Return if driver is not currently active
+	if (!m_eState)
+		return;
+
+	uint16_t uSize = m_uBufferSize;
+
+	for (uint8_t i=0; i<QAD_INPUTCAPTURE_CHANNEL_COUNT; i++) {
+		if (!m_sChannels[i].eActive)
+			continue;
+
+		Capture& sFirst  = m_sCapture[i];
+		Capture* pSecond = NULL;
+		uint16_t uWriteSecond = 0;
+
+		//In pulse width mode, the second channel's write index is read before the first channel's, which makes sure that every second edge
+		//being processed has the first edge that preceded it available
+		if (m_sChannels[i].eMode == QAD_InputCapture_PulseWidth) {
+			pSecond      = &m_sCapture[i+1];
+			uWriteSecond = getWriteIdx(i+1);
+		}
+		uint16_t uWriteFirst = getWriteIdx(i);
+
+		//Determine number of new timestamps
+		uint16_t uNew = (uint16_t)((uWriteFirst + uSize - sFirst.uReadIdx) % uSize);
+		sFirst.uReadIdx = uWriteFirst;
+		if (sFirst.uCaptured < 0x10000)
+			sFirst.uCaptured += uNew;
+		m_uSamples[i] = uNew;
+
+		if (pSecond) {
+			uint16_t uNewSecond = (uint16_t)((uWriteSecond + uSize - pSecond->uReadIdx) % uSize);
+			pSecond->uReadIdx = uWriteSecond;
+			if (pSecond->uCaptured < 0x10000)
+				pSecond->uCaptured += uNewSecond;
+			m_uSamples[i+1] = uNewSecond;
+		}
+
+		if (!uNew)
+			continue;
+
+		//Limit batch to the most recent timestamps
+		uint32_t uCount = uNew;
+		if (uCount > (uint32_t)(uSize / 2))
+			uCount = (uSize / 2);
+		if (uCount >= sFirst.uCaptured)
+			uCount = (sFirst.uCaptured - 1);
+		if (!uCount)
+			continue;
+
+		//Sum periods between consecutive timestamps
+		//Unsigned 16bit subtraction gives the correct period across a wrap of the timer counter
+		uint16_t* pFirst = sFirst.pBuffer.get();
+		uint16_t  uIdx   = uWriteFirst;
+		uint32_t  uSum   = 0;
+		for (uint32_t j=0; j<uCount; j++) {
+			uint16_t uCur  = (uint16_t)((uIdx + uSize - 1) % uSize);
+			uint16_t uPrev = (uint16_t)((uCur + uSize - 1) % uSize);
+			uSum += (uint16_t)(pFirst[uCur] - pFirst[uPrev]);
+			uIdx  = uCur;
+		}
+		m_uPeriodSum[i]   = uSum;
+		m_uPeriodCount[i] = uCount;
+
+		//Sum pulse widths
+		if ((pSecond) && (pSecond->uCaptured) && (uSum)) {
+			uint16_t* pSec    = pSecond->pBuffer.get();
+			uint32_t  uAvg    = (uSum / uCount);
+			uint16_t  uLastF  = (uint16_t)((uWriteFirst + uSize - 1) % uSize);
+			uint16_t  uLastS  = (uint16_t)((uWriteSecond + uSize - 1) % uSize);
+
+			//If the most recent second edge is further from the most recent first edge than a full period, then the first edge has been
+			//captured after the second edge, and each second edge pairs with the first edge before it
+			uint32_t uOffset = ((uint16_t)(pSec[uLastS] - pFirst[uLastF]) < uAvg) ? 0 : 1;
+
+			uint32_t uPairs = uCount;
+			if (uPairs > pSecond->uCaptured)
+				uPairs = pSecond->uCaptured;
+			if (uPairs > (sFirst.uCaptured - uOffset))
+				uPairs = (sFirst.uCaptured - uOffset);
+
+			uint32_t uWidth = 0;
+			for (uint32_t j=0; j<uPairs; j++) {
+				uint16_t uF = (uint16_t)((uLastF + (2 * uSize) - j - uOffset) % uSize);
+				uint16_t uS = (uint16_t)((uLastS + uSize - j) % uSize);
+				uWidth += (uint16_t)(pSec[uS] - pFirst[uF]);
+			}
+			m_uWidthSum[i]   = uWidth;
+			m_uWidthCount[i] = uPairs;
+		}
+	}
+}
+
+
+  //-----------------------------
+  //-----------------------------
+  //QAD_InputCapture Data Methods
+
+//QAD_InputCapture::getSamples
+//QAD_InputCapture Data Method
+//
+//Returns the number of new timestamps that were found for a channel by the most recent call to process()
+//A value of 0 indicates that no edges have been captured since the previous call
+//eChannel - The channel to retrieve the sample count for. A member of QAD_InputCapture_Channel
+uint32_t QAD_InputCapture::getSamples(QAD_InputCapture_Channel eChannel) {
+	if (eChannel >= QAD_INPUTCAPTURE_CHANNEL_COUNT)
+		return 0;
+
+	return m_uSamples[eChannel];
+}
+
+
+//QAD_InputCapture::getPeriod
+//QAD_InputCapture Data Method
+//
+//Returns the average period in timer ticks measured by the most recent batch, or 0 if no period has been measured
+//eChannel - The channel to retrieve the period for. A member of QAD_InputCapture_Channel
+uint32_t QAD_InputCapture::getPeriod(QAD_InputCapture_Channel eChannel) {
+	if ((eChannel >= QAD_INPUTCAPTURE_CHANNEL_COUNT) || (!m_uPeriodCount[eChannel]))
+		return 0;
+
+	return ((m_uPeriodSum[eChannel] + (m_uPeriodCount[eChannel] / 2)) / m_uPeriodCount[eChannel]);
+}
+
+
+//QAD_InputCapture::getFrequency_mHz
+//QAD_InputCapture Data Method
+//
+//Returns the average frequency in millihertz measured by the most recent batch, or 0 if no period has been measured
+//eChannel - The channel to retrieve the frequency for. A member of QAD_InputCapture_Channel
+uint32_t QAD_InputCapture::getFrequency_mHz(QAD_InputCapture_Channel eChannel) {
+	if ((eChannel >= QAD_INPUTCAPTURE_CHANNEL_COUNT) || (!m_uPeriodSum[eChannel]))
+		return 0;
+
+	return (uint32_t)(((uint64_t)getTickFrequency() * 1000 * m_uPeriodCount[eChannel]) / m_uPeriodSum[eChannel]);
+}
+
+
+//QAD_InputCapture::getPulseWidth
+//QAD_InputCapture Data Method
+//
+//Returns the average pulse width in timer ticks measured by the most recent batch, or 0 if no pulse width has been measured
+//Only available for channels 1 and 3 when set to pulse width mode
+//eChannel - The channel to retrieve the pulse width for. A member of QAD_InputCapture_Channel
+uint32_t QAD_InputCapture::getPulseWidth(QAD_InputCapture_Channel eChannel) {
+	if ((eChannel >= QAD_INPUTCAPTURE_CHANNEL_COUNT) || (!m_uWidthCount[eChannel]))
+		return 0;
+
+	return ((m_uWidthSum[eChannel] + (m_uWidthCount[eChannel] / 2)) / m_uWidthCount[eChannel]);
+}
+
+
+//QAD_InputCapture::getDuty
+//QAD_InputCapture Data Method
+//
+//Returns the average duty cycle measured by the most recent batch, in units of 0.01% (0 to 10000)
+//Only available for channels 1 and 3 when set to pulse width mode
+//eChannel - The channel to retrieve the duty cycle for. A member of QAD_InputCapture_Channel
+uint16_t QAD_InputCapture::getDuty(QAD_InputCapture_Channel eChannel) {
+	if ((eChannel >= QAD_INPUTCAPTURE_CHANNEL_COUNT) || (!m_uWidthCount[eChannel]) || (!m_uPeriodSum[eChannel]))
+		return 0;
+
+	uint64_t uDuty = (((uint64_t)m_uWidthSum[eChannel] * m_uPeriodCount[eChannel] * 10000) /
+			              ((uint64_t)m_uWidthCount[eChannel] * m_uPeriodSum[eChannel]));
+	if (uDuty > 10000)
+		uDuty = 10000;
+	return (uint16_t)uDuty;
+}
+
+
+//QAD_InputCapture::getTickFrequency
+//QAD_InputCapture Data Method
+//
+//Returns the frequency in Hz of the timer counter, which is the resolution of the period and pulse width measurements
+uint32_t QAD_InputCapture::getTickFrequency(void) {
+	return (QAD_TimerMgr::getClockSpeed(m_eTimer) / (m_uPrescaler + 1));
+}
+
+
+  //-----------------------------------------------
+  //-----------------------------------------------
+  //QAD_InputCapture Private Initialization Methods
+
+//QAD_InputCapture::periphInit
+//QAD_InputCapture Private Initialization Method
+//
+//Used to claim and initialize the DMA channels, GPIOs, timer peripheral clock, the timer peripheral itself and the respective capture channels
+//In the case of a failed initialization, a partial deinitialization will be performed to make sure the peripherals and clock
+//are all in the uninitialized state.
+//Returns QA_OK if successful
+//        QA_Fail if the channel configuration is invalid or initialization fails
+//        QA_Error_PeriphNotSupported if a capture channel has no DMA request
+//        QA_Error_PeriphBusy if a required DMA channel is already in use
+QA_Result QAD_InputCapture::periphInit(void) {
+	uint8_t uChannels = QAD_TimerMgr::getChannels(m_eTimer);
+
+	if (m_uBufferSize < 4)
+		return QA_Fail;
+
+	//Determine which capture channels are used, checking that pulse width mode is only used on channels 1 and 3
+	//and that the second channel of a pulse width pair is not also set as active
+	QA_Result eRes = QA_OK;
+	for (uint8_t i=0; i<uChannels; i++) {
+		if (m_sChannels[i].eActive) {
+			m_sCapture[i].eUsed = QA_Active;
+
+			if (m_sChannels[i].eMode == QAD_InputCapture_PulseWidth) {
+				if ((i & 0x01) || ((i+1) >= uChannels) || (m_sChannels[i+1].eActive)) {
+					eRes = QA_Fail;
+					break;
+				}
+				m_sCapture[i+1].eUsed = QA_Active;
+			}
+		}
+	}
+
+	//Check that all used capture channels have a DMA request
+	for (uint8_t i=0; (i<uChannels) && (!eRes); i++) {
+		if ((m_sCapture[i].eUsed) && (QAD_TimerMgr::getDMAChannelCC(m_eTimer, i) == QAD_DMA_ChannelNone))
+			eRes = QA_Error_PeriphNotSupported;
+	}
+
+	if (eRes) {
+		for (uint8_t i=0; i<QAD_INPUTCAPTURE_CHANNEL_COUNT; i++)
+			m_sCapture[i].eUsed = QA_Inactive;
+		return eRes;
+	}
+
+	//Register DMA channels and create ring buffers
+	for (uint8_t i=0; i<uChannels; i++) {
+		if (m_sCapture[i].eUsed) {
+			QAD_DMA_Channel eDMA = QAD_TimerMgr::getDMAChannelCC(m_eTimer, i);
+			if (QAD_DMAMgr::registerChannel(eDMA)) {
+				periphDeinit(DeinitPartial);
+				return QA_Error_PeriphBusy;
+			}
+			m_sCapture[i].eDMA    = eDMA;
+			m_sCapture[i].pBuffer = std::make_unique<uint16_t[]>(m_uBufferSize);
+		}
+	}
+
+	//Init GPIOs
+	GPIO_InitTypeDef GPIO_Init = {0};
+	GPIO_Init.Mode     = GPIO_MODE_AF_INPUT;   //Set pin to Alternate Function - Input mode
+	GPIO_Init.Pull     = GPIO_NOPULL;          //Disable pull-up and pull-down resistors
+	GPIO_Init.Speed    = GPIO_SPEED_FREQ_HIGH; //Unused for input pins
+
+	for (uint8_t i=0; i<uChannels; i++) {
+		if (m_sChannels[i].eActive) {
+			GPIO_Init.Pin = m_sChannels[i].uPin;
+			HAL_GPIO_Init(m_sChannels[i].pGPIO, &GPIO_Init);
+		}
+	}
+
+	//Enable Timer Clock
+	QAD_TimerMgr::enableClock(m_eTimer);
+
+	//Init Timer Input Capture Mode
+	m_sHandle.Instance                     = QAD_TimerMgr::getInstance(m_eTimer);  //Set instance for required timer peripheral
+	m_sHandle.Init.Prescaler               = m_uPrescaler;                         //Set timer prescaler
+	m_sHandle.Init.Period                  = 0xFFFF;                               //Set counter to free run over full 16bit range
+	m_sHandle.Init.CounterMode             = TIM_COUNTERMODE_UP;                   //Set counter mode to up
+	m_sHandle.Init.ClockDivision           = TIM_CLOCKDIVISION_DIV1;               //Unused
+	m_sHandle.Init.RepetitionCounter       = 0x0;                                  //
+	m_sHandle.Init.AutoReloadPreload       = TIM_AUTORELOAD_PRELOAD_DISABLE;       //Disable preload of the timer's auto-reload register
+
+	//Initialize Timer in Input Capture mode, performing a partial deinitialization if the initialization fails
+	if (HAL_TIM_IC_Init(&m_sHandle) != HAL_OK) {
+		periphDeinit(DeinitPartial);
+		return QA_Fail;
+	}
+
+	//Init Capture Channels
+	TIM_IC_InitTypeDef TIM_IC_Init;
+	for (uint8_t i=0; i<uChannels; i++) {
+		if (m_sChannels[i].eActive) {
+			uint32_t uPolarity = (m_sChannels[i].eEdge == QAD_InputCapture_Rising) ? TIM_ICPOLARITY_RISING : TIM_ICPOLARITY_FALLING;
+
+			TIM_IC_Init = {0};
+			TIM_IC_Init.ICPolarity  = uPolarity;                    //Set edge to be captured
+			TIM_IC_Init.ICSelection = TIM_ICSELECTION_DIRECTTI;     //Capture from channel's own input
+			TIM_IC_Init.ICPrescaler = TIM_ICPSC_DIV1;               //Capture every edge
+			TIM_IC_Init.ICFilter    = m_uFilter;                    //Set input filter
+
+			if (HAL_TIM_IC_ConfigChannel(&m_sHandle, &TIM_IC_Init, m_uChannelSelect[i]) != HAL_OK) {
+				periphDeinit(DeinitFull);
+				return QA_Fail;
+			}
+
+			//For pulse width mode, the following channel captures the opposite edge of the same input
+			if (m_sChannels[i].eMode == QAD_InputCapture_PulseWidth) {
+				TIM_IC_Init.ICPolarity  = (uPolarity == TIM_ICPOLARITY_RISING) ? TIM_ICPOLARITY_FALLING : TIM_ICPOLARITY_RISING;
+				TIM_IC_Init.ICSelection = TIM_ICSELECTION_INDIRECTTI;
+
+				if (HAL_TIM_IC_ConfigChannel(&m_sHandle, &TIM_IC_Init, m_uChannelSelect[i+1]) != HAL_OK) {
+					periphDeinit(DeinitFull);
+					return QA_Fail;
+				}
+			}
+		}
+	}
+
+	//Init DMA Channels
+	for (uint8_t i=0; i<uChannels; i++) {
+		if (m_sCapture[i].eUsed) {
+			DMA_HandleTypeDef& sDMA = m_sCapture[i].sDMA;
+			sDMA.Instance                 = QAD_DMAMgr::getInstance(m_sCapture[i].eDMA);  //Set instance for required DMA channel
+			sDMA.Init.Direction           = DMA_PERIPH_TO_MEMORY;                         //Transfer from capture register to memory
+			sDMA.Init.PeriphInc           = DMA_PINC_DISABLE;                             //Capture register address is fixed
+			sDMA.Init.MemInc              = DMA_MINC_ENABLE;                              //Increment through ring buffer
+			sDMA.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;                      //16bit capture register
+			sDMA.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;                      //16bit ring buffer entries
+			sDMA.Init.Mode                = DMA_CIRCULAR;                                 //Wrap around ring buffer continuously
+			sDMA.Init.Priority            = DMA_PRIORITY_HIGH;                            //
+
+			if (HAL_DMA_Init(&sDMA) != HAL_OK) {
+				periphDeinit(DeinitFull);
+				return QA_Fail;
+			}
+		}
+	}
+
+	//Set Driver States
+	m_eInitState = QA_Initialized; //Set driver state as initialized
+	m_eState     = QA_Inactive;    //Set driver as currently inactive
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_InputCapture::periphDeinit
+//QAD_InputCapture Private Initialization Method
+//
+//Used to deinitialize the DMA channels, GPIOs, timer peripheral clock and the timer peripheral itself
+//eDeinitMode - Set to DeinitPartial to perform a partial deinitialization (only to be used by periphInit() method
+//              in a case where peripheral initialization has failed
+//            - Set to DeinitFull to perform a full deinitialization in a case where the driver is fully initialized
+void QAD_InputCapture::periphDeinit(QAD_InputCapture::DeinitMode eDeinitMode) {
+
+	//Check if a full deinitialization is required
+	if (eDeinitMode) {
+
+		//Deinitialize Timer Peripheral
+		HAL_TIM_IC_DeInit(&m_sHandle);
+	}
+
+	//Disable Timer Clock
+	QAD_TimerMgr::disableClock(m_eTimer);
+
+	//Deinitialize GPIOs
+	for (uint8_t i=0; i<QAD_TimerMgr::getChannels(m_eTimer); i++) {
+		if (m_sChannels[i].eActive)
+			HAL_GPIO_DeInit(m_sChannels[i].pGPIO, m_sChannels[i].uPin);
+	}
+
+	//Deinitialize and deregister DMA channels, and release ring buffers
+	for (uint8_t i=0; i<QAD_INPUTCAPTURE_CHANNEL_COUNT; i++) {
+		if (m_sCapture[i].sDMA.Instance) {
+			HAL_DMA_DeInit(&m_sCapture[i].sDMA);
+			m_sCapture[i].sDMA.Instance = NULL;
+		}
+
+		if (m_sCapture[i].eDMA != QAD_DMA_ChannelNone) {
+			QAD_DMAMgr::deregisterChannel(m_sCapture[i].eDMA);
+			m_sCapture[i].eDMA = QAD_DMA_ChannelNone;
+		}
+
+		m_sCapture[i].pBuffer.reset();
+		m_sCapture[i].eUsed = QA_Inactive;
+	}
+
+	//Set Driver States
+	m_eState     = QA_Inactive;        //Set driver as currently inactive
+	m_eInitState = QA_NotInitialized;  //Set driver state as not initialized
+}
+
+
+  //-------------------------------------------
+  //-------------------------------------------
+  //QAD_InputCapture Private Processing Methods
+
+//QAD_InputCapture::getWriteIdx
+//QAD_InputCapture Private Processing Method
+//
+//Returns the index in a capture channel's ring buffer that the next timestamp will be written to by DMA
+//uChannel - The capture channel index
+uint16_t QAD_InputCapture::getWriteIdx(uint8_t uChannel) {
+	return (uint16_t)((m_uBufferSize - __HAL_DMA_GET_COUNTER(&m_sCapture[uChannel].sDMA)) % m_uBufferSize);
+}
@@ -0,0 +1,279 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Input Capture Driver                                            */
+/*   Filename: QAD_InputCapture.hpp                                        */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_INPUTCAPTURE_HPP_
+#define __QAD_INPUTCAPTURE_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include <memory>
+
+#include "QAD_TimerMgr.hpp"
+#include "QAD_DMAMgr.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------------------
+//QAD_INPUTCAPTURE_CHANNEL_COUNT
+//
+//Used to define the maximum number of channels that can be supported by the QAD_InputCapture driver
+#define QAD_INPUTCAPTURE_CHANNEL_COUNT   4
+
+
+//------------------------
+//QAD_InputCapture_Channel
+//
+//Enum used to select a specific input capture channel
+enum QAD_InputCapture_Channel : uint8_t {
+	QAD_InputCapture_Channel_1 = 0,
+	QAD_InputCapture_Channel_2,
+	QAD_InputCapture_Channel_3,
+	QAD_InputCapture_Channel_4
+};
+
+
+//---------------------
+//QAD_InputCapture_Mode
+//
+//Enum used to select the measurement mode of an input capture channel
+enum QAD_InputCapture_Mode : uint8_t {
+	QAD_InputCapture_Period = 0,   //The channel captures a single edge of its own input, allowing period and frequency to be measured
+	QAD_InputCapture_PulseWidth    //Only valid for channels 1 and 3. The channel captures the selected edge of its input, while the following
+	                               //channel (2 or 4) captures the opposite edge of the same input, allowing pulse width and duty cycle to also
+	                               //be measured. The following channel's pin is not used, and the channel must not be set as active
+	                               //This is required as the F1 series timers are unable to capture both edges on a single channel
+};
+
+
+//---------------------
+//QAD_InputCapture_Edge
+//
+//Enum used to select which edge of the input signal is captured
+//In pulse width mode, the selected edge is the start of the measured pulse
+enum QAD_InputCapture_Edge : uint8_t {
+	QAD_InputCapture_Rising = 0,
+	QAD_InputCapture_Falling
+};
+
+
+//-----------------------------------
+//QAD_InputCapture_Channel_InitStruct
+//
+//This structure is used to store data specific to individual input capture channels
+typedef struct {
+
+	QA_ActiveState        eActive;  //Stores whether this particular channel is active. Member of QA_ActiveState defined in setup.hpp
+
+	QAD_InputCapture_Mode eMode;    //Measurement mode of the channel. Member of QAD_InputCapture_Mode
+	QAD_InputCapture_Edge eEdge;    //Edge of the input signal to be captured. Member of QAD_InputCapture_Edge
+
+	GPIO_TypeDef*         pGPIO;    //GPIO port to be used by this channel
+	uint16_t              uPin;     //Pin number to be used by this channel
+
+} QAD_InputCapture_Channel_InitStruct;
+
+
+//---------------------------
+//QAD_InputCapture_InitStruct
+//
+//This structure is used to be able to create the QAD_InputCapture driver class
+typedef struct {
+
+	QAD_Timer_Periph  eTimer;        //Timer peripheral to be used. Member of QAD_Timer_Periph as defined in QAD_TimerMgr.hpp
+
+	uint32_t          uPrescaler;    //Prescaler to be used for the selected timer. The counter is free running over the full 16bit range, so the
+	                                 //prescaler is to be chosen such that the longest period to be measured is less than 65536 timer ticks
+
+	uint8_t           uFilter;       //Input filter to be applied to all channels (a value between 0 and 15, see the ICxF bits of TIMx_CCMRx)
+
+	uint16_t          uBufferSize;   //Number of capture timestamps to be stored in the DMA ring buffer of each capture channel
+
+	QAD_InputCapture_Channel_InitStruct sChannels[QAD_INPUTCAPTURE_CHANNEL_COUNT];  //Data for individual input capture channels
+
+} QAD_InputCapture_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//----------------
+//QAD_InputCapture
+//
+//Driver class used to measure the period, frequency, pulse width and duty cycle of signals on up to four timer input capture channels
+//
+//Each capture channel streams its capture register into a circular ring buffer using DMA, so no interrupt is raised per captured edge and
+//signals well above 100kHz can be measured without loading the CPU. The process() method is to be called regularly (such as from the
+//main processing loop) and processes all timestamps captured since the previous call as a single batch to produce averaged results.
+//
+//Each capture channel requires its own DMA channel, as mapped in the m_sTimers table in QAD_TimerMgr.hpp and returned by
+//QAD_TimerMgr::getDMAChannelCC(). DMA channels are claimed through QAD_DMAMgr, and initialization will fail with QA_Error_PeriphBusy
+//if any are already in use, or with QA_Error_PeriphNotSupported if a capture channel has no DMA request (Timer 3 channel 2).
+class QAD_InputCapture {
+private:
+
+	//Deinitialization mode to be used by periphDeinit() method
+  enum DeinitMode : uint8_t {
+  	DeinitPartial = 0,    //Only to be used for partial deinitialization upon initialization failure in periphInit() method
+  	DeinitFull            //Used for full driver deinitialization when driver is in a fully initialized state
+  };
+
+  //Per capture channel data
+  typedef struct {
+  	QA_ActiveState              eUsed;       //Stores whether the capture channel is used, either directly or as the second channel of a pulse width pair
+  	QAD_DMA_Channel             eDMA;        //DMA channel used to stream the capture register into the ring buffer
+  	DMA_HandleTypeDef           sDMA;        //Handle used by HAL functions to access the DMA channel
+  	std::unique_ptr<uint16_t[]> pBuffer;     //DMA ring buffer of capture timestamps
+  	uint16_t                    uReadIdx;    //Index in ring buffer of the next timestamp to be processed
+  	uint32_t                    uCaptured;   //Number of timestamps captured since the driver was started (saturates)
+  } Capture;
+
+  QA_InitState       m_eInitState;  //Stores whether the driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+  QA_ActiveState     m_eState;      //Stores whether the driver is currently active. Member of QA_ActiveState enum defined in setup.hpp
+
+  QAD_Timer_Periph   m_eTimer;      //Stores the particular timer peripheral to be used by the driver
+                                    //Member of QAD_Timer_Periph as defined in QAD_TimerMgr.hpp
+
+  TIM_HandleTypeDef  m_sHandle;     //Handle used by HAL functions to access Timer peripheral (defined in stm32f1xx_hal_tim.h)
+
+  uint32_t           m_uPrescaler;  //Prescaler to be used for selected timer
+  uint8_t            m_uFilter;     //Input filter to be applied to all channels
+  uint16_t           m_uBufferSize; //Number of timestamps stored in each ring buffer
+
+  QAD_InputCapture_Channel_InitStruct m_sChannels[QAD_INPUTCAPTURE_CHANNEL_COUNT];  //Array of channel specific initialization data
+  Capture            m_sCapture[QAD_INPUTCAPTURE_CHANNEL_COUNT];                    //Array of capture channel data
+
+  uint32_t           m_uPeriodSum[QAD_INPUTCAPTURE_CHANNEL_COUNT];    //Sum of periods in timer ticks measured in the most recent batch
+  uint32_t           m_uPeriodCount[QAD_INPUTCAPTURE_CHANNEL_COUNT];  //Number of periods measured in the most recent batch
+  uint32_t           m_uWidthSum[QAD_INPUTCAPTURE_CHANNEL_COUNT];     //Sum of pulse widths in timer ticks measured in the most recent batch
+  uint32_t           m_uWidthCount[QAD_INPUTCAPTURE_CHANNEL_COUNT];   //Number of pulse widths measured in the most recent batch
+  uint32_t           m_uSamples[QAD_INPUTCAPTURE_CHANNEL_COUNT];      //Number of new timestamps found by the most recent call to process()
+
+  uint32_t           m_uChannelSelect[QAD_INPUTCAPTURE_CHANNEL_COUNT];  //Array used to select TIM_Channel defines as defined in stm32f1xx_hal_tim.h
+  uint32_t           m_uDMASelect[QAD_INPUTCAPTURE_CHANNEL_COUNT];      //Array used to select TIM_DMA defines as defined in stm32f1xx_hal_tim.h
+
+public:
+
+  //--------------------------
+	//Constructors / Destructors
+
+  QAD_InputCapture() = delete;                            //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+  QAD_InputCapture(QAD_InputCapture_InitStruct& sInit) :  //The class constructor to be used, which has a reference to an initialization structure passed to it
+  	m_eInitState(QA_NotInitialized),
+		m_eState(QA_Inactive),
+		m_eTimer(sInit.eTimer),
+		m_sHandle({0}),
+		m_uPrescaler(sInit.uPrescaler),
+		m_uFilter(sInit.uFilter),
+		m_uBufferSize(sInit.uBufferSize) {
+
+  	//Copy channel specific data from initialization structure and clear capture channel data
+  	for (uint8_t i=0; i<QAD_INPUTCAPTURE_CHANNEL_COUNT; i++) {
+  		m_sChannels[i]          = sInit.sChannels[i];
+  		m_sCapture[i].eUsed     = QA_Inactive;
+  		m_sCapture[i].eDMA      = QAD_DMA_ChannelNone;
+  		m_sCapture[i].sDMA      = {0};
+  		m_sCapture[i].uReadIdx  = 0;
+  		m_sCapture[i].uCaptured = 0;
+  		m_uPeriodSum[i]         = 0;
+  		m_uPeriodCount[i]       = 0;
+  		m_uWidthSum[i]          = 0;
+  		m_uWidthCount[i]        = 0;
+  		m_uSamples[i]           = 0;
+  	}
+
+  	//Fill out m_uChannelSelect and m_uDMASelect arrays
+  	m_uChannelSelect[QAD_InputCapture_Channel_1] = TIM_CHANNEL_1;
+  	m_uChannelSelect[QAD_InputCapture_Channel_2] = TIM_CHANNEL_2;
+  	m_uChannelSelect[QAD_InputCapture_Channel_3] = TIM_CHANNEL_3;
+  	m_uChannelSelect[QAD_InputCapture_Channel_4] = TIM_CHANNEL_4;
+
+  	m_uDMASelect[QAD_InputCapture_Channel_1]     = TIM_DMA_CC1;
+  	m_uDMASelect[QAD_InputCapture_Channel_2]     = TIM_DMA_CC2;
+  	m_uDMASelect[QAD_InputCapture_Channel_3]     = TIM_DMA_CC3;
+  	m_uDMASelect[QAD_InputCapture_Channel_4]     = TIM_DMA_CC4;
+  }
+
+  ~QAD_InputCapture() {        //Destructor to make sure peripheral is made inactive and deinitialized upon class destruction
+
+  	//Stop input capture driver if currently active
+  	if (m_eState)
+  		stop();
+
+  	//Deinitialize input capture driver if currently initialized
+  	if (m_eInitState)
+  		deinit();
+  }
+
+
+  //NOTE: See QAD_InputCapture.cpp for details of the following functions
+
+  //----------------------
+  //Initialization Methods
+
+  QA_Result init(void);
+  void deinit(void);
+
+
+  //---------------
+  //Control Methods
+
+  void start(void);
+  void stop(void);
+
+  void process(void);
+
+
+  //---------------
+  //Data Methods
+
+  uint32_t getSamples(QAD_InputCapture_Channel eChannel);
+
+  uint32_t getPeriod(QAD_InputCapture_Channel eChannel);
+  uint32_t getFrequency_mHz(QAD_InputCapture_Channel eChannel);
+
+  uint32_t getPulseWidth(QAD_InputCapture_Channel eChannel);
+  uint16_t getDuty(QAD_InputCapture_Channel eChannel);
+
+  uint32_t getTickFrequency(void);
+
+private:
+
+  //----------------------
+  //Initialization Methods
+
+  QA_Result periphInit(void);
+  void periphDeinit(DeinitMode eDeinitMode);
+
+
+  //-------------------
+  //Processing Methods
+
+  uint16_t getWriteIdx(uint8_t uChannel);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_INPUTCAPTURE_HPP_ */
@@ -39,15 +39,42 @@ QA_Result QAD_PWM::init(void) {
   if (QAD_TimerMgr::getState(m_eTimer))
   	return QA_Error_PeriphBusy;
 
+  //Check that complementary outputs, dead time and break input are only used with an advanced-control timer, and that
+  //complementary outputs are only used on channels 1 to 3
+  if (getAdvancedUsed()) {
+  	if (!QAD_TimerMgr::getAdvanced(m_eTimer))
+  		return QA_Error_PeriphNotSupported;
+
+  	if ((m_sChannels[QAD_PWM_Channel_4].eActive) && (m_sChannels[QAD_PWM_Channel_4].eComplementary))
+  		return QA_Error_PeriphNotSupported;
+  }
+
+  //Check that a dead time is set when complementary outputs are used, as without one both sides of a half-bridge would switch at the same
+  //instant, causing shoot-through
+  for (uint8_t i=0; i<QAD_PWM_CHANNEL_COUNT; i++) {
+  	if ((m_sChannels[i].eActive) && (m_sChannels[i].eComplementary) && (!m_uDeadTime_ns))
+  		return QA_Fail;
+  }
+
+  //If streaming is enabled then claim the timer's update DMA channel
+  if (m_eStream) {
+  	m_eStreamDMA = QAD_TimerMgr::getDMAChannelUpdate(m_eTimer);
+  	if (QAD_DMAMgr::registerChannel(m_eStreamDMA))
+  		return QA_Error_PeriphBusy;
+  }
+
   //Register Timer peripheral as now being in use
   QAD_TimerMgr::registerTimer(m_eTimer, QAD_Timer_InUse_PWM);
 
   //Initialize the Timer peripheral
   QA_Result eRes = periphInit();
 
-  //If initialization failed then deregister the Timer peripheral
-  if (eRes)
+  //If initialization failed then deregister the Timer peripheral and DMA channel
+  if (eRes) {
   	QAD_TimerMgr::deregisterTimer(m_eTimer);
+  	if (m_eStream)
+  		QAD_DMAMgr::deregisterChannel(m_eStreamDMA);
+  }
 
   //Return initialization result
   return eRes;
@@ -67,8 +94,51 @@ void QAD_PWM::deinit(void) {
   //Deinitialize PWM driver
   periphDeinit(DeinitFull);
 
-  //Deregister Timer peripheral
+  //Deregister Timer peripheral and DMA channel
   QAD_TimerMgr::deregisterTimer(m_eTimer);
+  if (m_eStream)
+  	QAD_DMAMgr::deregisterChannel(m_eStreamDMA);
+}
+
+
+  //---------------------------
+  //---------------------------
+  //QAD_PWM IRQ Handler Methods
+
+//QAD_PWM::handler
+//QAD_PWM IRQ Handler Method
+//
+//To be called from the IRQ handler function of the timer's update DMA channel in handlers.cpp
+//Calls the stream callback delegate as each half of the buffer is completed in circular mode, or when the whole buffer has been
+//completed in single mode, in which case the stream is also stopped
+//The half transfer event is only reported in circular mode, as its interrupt is not enabled in single mode
+void QAD_PWM::handler(void) {
+	uint8_t uEvents = QAD_DMAMgr::getBufferEvents(&m_sDMA);
+	QAD_PWM_StreamBlock sBlock;
+	sBlock.uChannels = m_uStreamChannels;
+
+	//Half Transfer
+	if (uEvents & QAD_DMA_Event_Half) {
+		sBlock.eEvent   = QAD_PWM_Stream_HalfFirst;
+		sBlock.pValues  = m_pStreamBuffer;
+		sBlock.uPeriods = m_uStreamPeriods / 2;
+		m_sStreamHandler(&sBlock);
+	}
+
+	//Transfer Complete
+	if (uEvents & QAD_DMA_Event_Complete) {
+		if (m_eStreamMode == QAD_PWM_StreamCircular) {
+			sBlock.eEvent   = QAD_PWM_Stream_HalfSecond;
+			sBlock.pValues  = m_pStreamBuffer + ((m_uStreamPeriods / 2) * m_uStreamChannels);
+			sBlock.uPeriods = m_uStreamPeriods / 2;
+		} else {
+			stopStream();
+			sBlock.eEvent   = QAD_PWM_Stream_Complete;
+			sBlock.pValues  = m_pStreamBuffer;
+			sBlock.uPeriods = m_uStreamPeriods;
+		}
+		m_sStreamHandler(&sBlock);
+	}
 }
 
 
@@ -80,18 +150,36 @@ void QAD_PWM::deinit(void) {
 //QAD_PWM Control Method
 //
 //Starts the PWM driver
-void QAD_PWM::start(void) {
+//For advanced-control timers the driver will not start while a break is latched (by the break input or emergencyStop()), as starting
+//the outputs sets the main output enable (MOE). clearBreak() is required before the driver can be started again
+//Returns QA_OK if successful
+//        QA_Fail if the driver is not initialized, or a break is latched
+QA_Result QAD_PWM::start(void) {
+
+	//Check driver state and break flag
+	if (!m_eInitState)
+		return QA_Fail;
+
+	if ((QAD_TimerMgr::getAdvanced(m_eTimer)) && (__HAL_TIM_GET_FLAG(&m_sHandle, TIM_FLAG_BREAK)))
+		return QA_Fail;
 
 	//Iterate through the number of channels supported by the specific timer peripheral
 	for (uint8_t i=0; i<QAD_TimerMgr::getChannels(m_eTimer); i++) {
 
-		//If channel is set to active then start PWM on that channel
-		if (m_sChannels[i].eActive)
+		//If channel is set to active then start PWM on that channel, and its complementary output if enabled
+		//For advanced-control timers this also sets the main output enable (MOE)
+		if (m_sChannels[i].eActive) {
 			HAL_TIM_PWM_Start(&m_sHandle, m_uChannelSelect[i]);
+			if (m_sChannels[i].eComplementary)
+				HAL_TIMEx_PWMN_Start(&m_sHandle, m_uChannelSelect[i]);
+		}
 	}
 
 	//Set PWM driver state to active
 	m_eState = QA_Active;
+
+	//Return
+	return QA_OK;
 }
 
 
@@ -104,9 +192,12 @@ void QAD_PWM::stop(void) {
 	//Iterate through the number of channels supported by the specific timer peripheral
 	for (uint8_t i=0; i<QAD_TimerMgr::getChannels(m_eTimer); i++) {
 
-		//If channel is currently active then stop PWM on that channel
-		if (m_sChannels[i].eActive)
+		//If channel is currently active then stop PWM on that channel, and its complementary output if enabled
+		if (m_sChannels[i].eActive) {
+			if (m_sChannels[i].eComplementary)
+				HAL_TIMEx_PWMN_Stop(&m_sHandle, m_uChannelSelect[i]);
 			HAL_TIM_PWM_Stop(&m_sHandle, m_uChannelSelect[i]);
+		}
 	}
 
 	//Set PWM driver state to inactive
@@ -131,6 +222,414 @@ void QAD_PWM::setPWMVal(QAD_PWM_Channel eChannel, uint16_t uVal) {
 }
 
 
+//QAD_PWM::setPWMVals
+//QAD_PWM Control Method
+//
+//Sets the current PWM values for all active channels, so that they all change on the same update event
+//As compare registers are preloaded, the new values are written with update events disabled so that a PWM period can never start with
+//only some of them updated. If the driver is not running, an update event is generated so that the values are loaded immediately
+//pVals - Array of PWM values, one for each channel supported by the timer peripheral (values for inactive channels are ignored)
+void QAD_PWM::setPWMVals(const uint16_t* pVals) {
+
+	//Return if driver is not initialized
+	if ((!m_eInitState) || (!pVals))
+		return;
+
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	//Write compare values with update events disabled
+	m_sHandle.Instance->CR1 |= TIM_CR1_UDIS;
+	for (uint8_t i=0; i<QAD_TimerMgr::getChannels(m_eTimer); i++) {
+		if (m_sChannels[i].eActive)
+			__HAL_TIM_SET_COMPARE(&m_sHandle, m_uChannelSelect[i], pVals[i]);
+	}
+	m_sHandle.Instance->CR1 &= ~TIM_CR1_UDIS;
+
+	//If PWM is not running (and no stream is waiting for update events) then load values immediately
+	if ((!m_eState) && (!m_eStreamState))
+		m_sHandle.Instance->EGR = TIM_EGR_UG;
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+//QAD_PWM::setFrequency
+//QAD_PWM Control Method
+//
+//Used to set the PWM frequency, with the prescaler and period being found by QAD_TimerMgr::calcFrequency()
+//In center-aligned mode the counter runs at twice the PWM frequency, so uResolution applies to each half of the PWM period
+//The compare value of each active channel is rescaled to the new period so that duty cycles are maintained. As the prescaler, period
+//and compare registers are all preloaded, the new values are written with update events disabled so that they take effect together
+//at the end of the current PWM period, preventing glitches on the outputs
+//The frequency cannot be changed while a stream is active, as the stream buffer holds compare values for the current period. While
+//dithering is active the pattern is recalculated for the new period
+//uFrequency  - The required PWM frequency in Hz. Use getFrequency() to retrieve the frequency actually achieved
+//uResolution - The minimum number of timer ticks per PWM period (per half period in center-aligned mode). Use getPeriod() to retrieve
+//              the period actually used
+//Returns QA_OK if successful
+//        QA_Error_PeriphBusy if a stream is active
+//        QA_Fail if the frequency cannot be produced at the required resolution
+QA_Result QAD_PWM::setFrequency(uint32_t uFrequency, uint32_t uResolution) {
+
+	//Check that no stream is active, other than the dither pattern
+	if ((m_eStreamState) && (!m_eDitherState))
+		return QA_Error_PeriphBusy;
+
+	//Find prescaler and period for the required frequency
+	uint32_t uOldTicks = getPeriodTicks();
+	if (!calcPeriod(uFrequency, uResolution))
+		return QA_Fail;
+
+	//If driver is not initialized then the new values will be used by periphInit()
+	if (!m_eInitState)
+		return QA_OK;
+
+	m_sHandle.Init.Prescaler = m_uPrescaler;
+	m_sHandle.Init.Period    = m_uPeriod;
+
+	//Write preload registers with update events disabled
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	m_sHandle.Instance->CR1 |= TIM_CR1_UDIS;
+	m_sHandle.Instance->PSC  = m_uPrescaler;
+	m_sHandle.Instance->ARR  = m_uPeriod;
+
+	//Rescale compare values of active channels to the new period
+	for (uint8_t i=0; i<QAD_TimerMgr::getChannels(m_eTimer); i++) {
+		if (m_sChannels[i].eActive) {
+			uint64_t uCompare = __HAL_TIM_GET_COMPARE(&m_sHandle, m_uChannelSelect[i]);
+			__HAL_TIM_SET_COMPARE(&m_sHandle, m_uChannelSelect[i], (uint32_t)((uCompare * getPeriodTicks()) / uOldTicks));
+		}
+	}
+
+	m_sHandle.Instance->CR1 &= ~TIM_CR1_UDIS;
+
+	//If PWM is not running (and no stream is waiting for update events) then generate an update event to load the new values immediately
+	if ((!m_eState) && (!m_eStreamState))
+		m_sHandle.Instance->EGR = TIM_EGR_UG;
+
+	__set_PRIMASK(uPriMask);
+
+	//Recalculate dither pattern for the new period
+	if (m_eDitherState) {
+		for (uint8_t i=0; i<QAD_TimerMgr::getChannels(m_eTimer); i++) {
+			if (m_sChannels[i].eActive)
+				fillDither(i);
+		}
+	}
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_PWM::getFrequency
+//QAD_PWM Control Method
+//
+//Returns the PWM frequency in Hz produced by the current prescaler and period, rounded to the nearest Hz
+//In center-aligned mode the counter counts from 0 up to the period and back down to 0, so each PWM period is 2*period timer ticks
+uint32_t QAD_PWM::getFrequency(void) {
+	if (m_eCounterMode == QAD_PWM_CenterAligned)
+		return QAD_TimerMgr::getFrequency(m_eTimer, m_uPrescaler, (2 * m_uPeriod) - 1);
+	return QAD_TimerMgr::getFrequency(m_eTimer, m_uPrescaler, m_uPeriod);
+}
+
+
+//QAD_PWM::getPeriod
+//QAD_PWM Control Method
+//
+//Returns the current counter period. PWM values passed to setPWMVal() range from 0 (0% duty) to getPeriod()+1 (100% duty)
+//In center-aligned mode PWM values range from 0 (0% duty) to getPeriod() (100% duty)
+uint32_t QAD_PWM::getPeriod(void) {
+	return m_uPeriod;
+}
+
+
+  //----------------------
+  //----------------------
+  //QAD_PWM Stream Methods
+
+//QAD_PWM::setStreamHandler
+//QAD_PWM Stream Method
+//
+//Used to set the callback delegate to be called as parts of the stream buffer are completed
+//The delegate's event data (pData) is a pointer to a QAD_PWM_StreamBlock structure
+//sHandler - The callback delegate (QAT_Delegate defined in QAT_Delegate.hpp)
+void QAD_PWM::setStreamHandler(const QAT_Delegate& sHandler) {
+	m_sStreamHandler = sHandler;
+}
+
+
+//QAD_PWM::startStream
+//QAD_PWM Stream Method
+//
+//Used to start streaming compare values from a buffer, with one set of values being transferred on each timer update event
+//The stream only progresses while the PWM driver is running, so can be started either before or after start() is called
+//pBuffer  - Buffer of interleaved compare values, holding one value per PWM period for each channel from the lowest to the highest
+//           active channel. The buffer must remain valid until the stream is stopped or completed
+//uPeriods - Number of PWM periods in the buffer. Must be even in circular mode, so that the buffer divides into two halves
+//eMode    - Member of QAD_PWM_StreamMode to select whether the buffer is streamed once or continuously
+//Returns QA_OK if successful
+//        QA_Error_PeriphNotSupported if streaming was not enabled in the initialization structure
+//        QA_Error_PeriphBusy if a stream is already active
+//        QA_Fail if the driver is not initialized, or the buffer is invalid
+QA_Result QAD_PWM::startStream(uint16_t* pBuffer, uint32_t uPeriods, QAD_PWM_StreamMode eMode) {
+
+	//Check driver state
+	if (!m_eInitState)
+		return QA_Fail;
+
+	if (!m_eStream)
+		return QA_Error_PeriphNotSupported;
+
+	if (m_eStreamState)
+		return QA_Error_PeriphBusy;
+
+	//Check buffer, as DMA transfer count is limited to 16bits
+	uint32_t uTransfers = uPeriods * m_uStreamChannels;
+	if ((!pBuffer) || (!uTransfers) || (uTransfers > 0xFFFF) || ((eMode == QAD_PWM_StreamCircular) && (uPeriods & 0x01)))
+		return QA_Fail;
+
+	//Store stream details
+	m_eStreamMode    = eMode;
+	m_pStreamBuffer  = pBuffer;
+	m_uStreamPeriods = uPeriods;
+
+	//Set DMA burst to start at compare register of first active channel and transfer one value for each channel in range
+	m_sHandle.Instance->DCR = ((uint32_t)(m_uStreamChannels - 1) << TIM_DCR_DBL_Pos) | (TIM_DMABASE_CCR1 + m_uStreamFirst);
+
+	//Set DMA mode
+	m_sDMA.Init.Mode = (eMode == QAD_PWM_StreamCircular) ? DMA_CIRCULAR : DMA_NORMAL;
+	if (eMode == QAD_PWM_StreamCircular)
+		SET_BIT(m_sDMA.Instance->CCR, DMA_CCR_CIRC);
+	else
+		CLEAR_BIT(m_sDMA.Instance->CCR, DMA_CCR_CIRC);
+
+	//Start DMA transfer from buffer to timer DMA burst register, with half transfer interrupt only being required in circular mode
+	HAL_DMA_Start(&m_sDMA, (uint32_t)pBuffer, (uint32_t)&m_sHandle.Instance->DMAR, uTransfers);
+	__HAL_DMA_ENABLE_IT(&m_sDMA, (eMode == QAD_PWM_StreamCircular) ? (DMA_IT_HT | DMA_IT_TC) : DMA_IT_TC);
+	HAL_NVIC_EnableIRQ(QAD_DMAMgr::getIRQ(m_eStreamDMA));
+
+	//Enable timer update DMA request
+	__HAL_TIM_ENABLE_DMA(&m_sHandle, TIM_DMA_UPDATE);
+
+	//Set stream state to active
+	m_eStreamState = QA_Active;
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_PWM::stopStream
+//QAD_PWM Stream Method
+//
+//Used to stop the current stream. The compare values most recently transferred continue to be output
+void QAD_PWM::stopStream(void) {
+
+	//Return if no stream is active
+	if (!m_eStreamState)
+		return;
+
+	//Disable timer update DMA request
+	__HAL_TIM_DISABLE_DMA(&m_sHandle, TIM_DMA_UPDATE);
+
+	//Stop DMA transfer
+	HAL_NVIC_DisableIRQ(QAD_DMAMgr::getIRQ(m_eStreamDMA));
+	HAL_DMA_Abort(&m_sDMA);
+
+	//Set stream and dither states to inactive
+	m_eStreamState = QA_Inactive;
+	m_eDitherState = QA_Inactive;
+}
+
+
+//QAD_PWM::getStreamState
+//QAD_PWM Stream Method
+//
+//Returns QA_Active if a stream is currently active, or QA_Inactive if not
+QA_ActiveState QAD_PWM::getStreamState(void) {
+	return m_eStreamState;
+}
+
+
+  //----------------------
+  //----------------------
+  //QAD_PWM Dither Methods
+
+//QAD_PWM::setDitherVal
+//QAD_PWM Dither Method
+//
+//Sets the 16bit value of a channel used in dithering mode. The average compare value is uVal * (getPeriod()+1) / 65536, or
+//uVal * getPeriod() / 65536 in center-aligned mode, resolved to 1/QAD_PWM_DITHER_PERIODS of a timer tick
+//Values can be set before startDither() is called. While dithering is active the channel's part of the pattern is recalculated, and as
+//the DMA continues to run during this, one pattern cycle may mix the old and new values
+//eChannel - The PWM channel to set the value for. A member of QAD_PWM_Channel as defined in QAD_PWM.hpp
+//uVal     - The 16bit dither value, from 0 (0% duty) to 65535 (just below 100% duty)
+void QAD_PWM::setDitherVal(QAD_PWM_Channel eChannel, uint16_t uVal) {
+
+	//Return if the selected channel is higher than the number of channels supported by the selected timer peripheral
+	if (eChannel >= QAD_TimerMgr::getChannels(m_eTimer))
+		return;
+
+	//Store value and recalculate pattern if dithering is active
+	m_uDitherVals[eChannel] = uVal;
+	if ((m_eDitherState) && (m_sChannels[eChannel].eActive))
+		fillDither(eChannel);
+}
+
+
+//QAD_PWM::startDither
+//QAD_PWM Dither Method
+//
+//Used to start dithering mode, which continuously streams a pattern calculated from the values set by setDitherVal()
+//The stream DMA interrupts are disabled, so no stream callbacks are made while dithering
+//Returns QA_OK if successful
+//        QA_Error_PeriphNotSupported if streaming was not enabled in the initialization structure
+//        QA_Error_PeriphBusy if a stream is already active
+//        QA_Fail if the driver is not initialized or has no active channels
+QA_Result QAD_PWM::startDither(void) {
+
+	//Check driver state
+	if ((!m_eInitState) || (!m_uStreamChannels))
+		return QA_Fail;
+
+	if (!m_eStream)
+		return QA_Error_PeriphNotSupported;
+
+	if (m_eStreamState)
+		return QA_Error_PeriphBusy;
+
+	//Create pattern buffer, which is kept until the driver is deinitialized so that it can be reused
+	if (!m_pDitherBuffer)
+		m_pDitherBuffer = std::make_unique<uint16_t[]>(QAD_PWM_DITHER_PERIODS * m_uStreamChannels);
+
+	//Calculate pattern for each channel updated by the DMA burst, with inactive channels in the range being set to 0
+	for (uint8_t i=m_uStreamFirst; i<(m_uStreamFirst + m_uStreamChannels); i++) {
+		if (m_sChannels[i].eActive) {
+			fillDither(i);
+		} else {
+			for (uint32_t j=0; j<QAD_PWM_DITHER_PERIODS; j++)
+				m_pDitherBuffer[(j * m_uStreamChannels) + (i - m_uStreamFirst)] = 0;
+		}
+	}
+
+	//Start circular stream of pattern
+	QA_Result eRes = startStream(m_pDitherBuffer.get(), QAD_PWM_DITHER_PERIODS, QAD_PWM_StreamCircular);
+	if (eRes)
+		return eRes;
+
+	//Disable DMA interrupts, as the pattern does not need to be refilled
+	__HAL_DMA_DISABLE_IT(&m_sDMA, DMA_IT_HT | DMA_IT_TC);
+
+	//Set dither state to active
+	m_eDitherState = QA_Active;
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_PWM::stopDither
+//QAD_PWM Dither Method
+//
+//Used to stop dithering mode. Each active channel is left at the compare value nearest to its dither value
+void QAD_PWM::stopDither(void) {
+
+	//Return if dithering is not active
+	if (!m_eDitherState)
+		return;
+
+	//Stop stream
+	stopStream();
+
+	//Set compare values to the nearest whole timer tick
+	uint16_t uVals[QAD_PWM_CHANNEL_COUNT];
+	for (uint8_t i=0; i<QAD_PWM_CHANNEL_COUNT; i++)
+		uVals[i] = (uint16_t)((((uint32_t)m_uDitherVals[i] * getPeriodTicks()) + 0x8000) >> 16);
+	setPWMVals(uVals);
+}
+
+
+//QAD_PWM::getDitherState
+//QAD_PWM Dither Method
+//
+//Returns QA_Active if dithering mode is currently active, or QA_Inactive if not
+QA_ActiveState QAD_PWM::getDitherState(void) {
+	return m_eDitherState;
+}
+
+
+  //---------------------
+  //---------------------
+  //QAD_PWM Break Methods
+
+//QAD_PWM::emergencyStop
+//QAD_PWM Break Method
+//
+//Used to immediately disable all PWM outputs
+//For advanced-control timers a break event is generated by software, which disables the outputs in the same way as the break input
+//and requires clearBreak() to re-enable them. For general purpose timers the driver is stopped
+void QAD_PWM::emergencyStop(void) {
+
+	//Return if driver is not initialized
+	if (!m_eInitState)
+		return;
+
+	if (QAD_TimerMgr::getAdvanced(m_eTimer))
+		m_sHandle.Instance->EGR = TIM_EGR_BG;
+	else
+		stop();
+}
+
+
+//QAD_PWM::getBreakState
+//QAD_PWM Break Method
+//
+//Returns QA_Active if a break is latched by the break input or emergencyStop(), or if the driver is running but its outputs have been
+//disabled, or QA_Inactive if not
+//Always returns QA_Inactive for general purpose timers
+QA_ActiveState QAD_PWM::getBreakState(void) {
+	if ((!m_eInitState) || (!QAD_TimerMgr::getAdvanced(m_eTimer)))
+		return QA_Inactive;
+
+	if (__HAL_TIM_GET_FLAG(&m_sHandle, TIM_FLAG_BREAK))
+		return QA_Active;
+
+	return ((m_eState) && (!(m_sHandle.Instance->BDTR & TIM_BDTR_MOE))) ? QA_Active : QA_Inactive;
+}
+
+
+//QAD_PWM::clearBreak
+//QAD_PWM Break Method
+//
+//Used to clear a latched break after the outputs have been disabled by the break input or emergencyStop()
+//If the driver is running then the outputs are re-enabled, otherwise start() can be called once the break has been cleared
+//Returns QA_OK if the break has been cleared
+//        QA_Fail if the break could not be cleared, due to the break input still being asserted
+//        QA_Error_PeriphNotSupported if the driver is not initialized on an advanced-control timer
+QA_Result QAD_PWM::clearBreak(void) {
+	if ((!m_eInitState) || (!QAD_TimerMgr::getAdvanced(m_eTimer)))
+		return QA_Error_PeriphNotSupported;
+
+	//Clear break flag, which is set again immediately while the break input is asserted
+	__HAL_TIM_CLEAR_FLAG(&m_sHandle, TIM_FLAG_BREAK);
+	if (__HAL_TIM_GET_FLAG(&m_sHandle, TIM_FLAG_BREAK))
+		return QA_Fail;
+
+	//If the driver is running then set main output enable
+	if (m_eState) {
+		__HAL_TIM_MOE_ENABLE(&m_sHandle);
+		return (m_sHandle.Instance->BDTR & TIM_BDTR_MOE) ? QA_OK : QA_Fail;
+	}
+
+	//Return
+	return QA_OK;
+}
+
+
   //--------------------------------------
   //--------------------------------------
   //QAD_PWM Private Initialization Methods
@@ -160,9 +659,23 @@ QA_Result QAD_PWM::periphInit(void) {
 			GPIO_Init.Pin         = m_sChannels[i].uPin; //Set pin number
 			//GPIO_Init.Alternate   = m_sChannels[i].uAF;  //Set alternate function to suit required timer peripheral
 			HAL_GPIO_Init(m_sChannels[i].pGPIO, &GPIO_Init);
+
+			//Initialize complementary output GPIO pin if enabled
+			if (m_sChannels[i].eComplementary) {
+				GPIO_Init.Pin = m_sChannels[i].uPinN;
+				HAL_GPIO_Init(m_sChannels[i].pGPION, &GPIO_Init);
+			}
 		}
 	}
 
+	//Initialize break input GPIO pin if enabled, with pull resistor holding the input in its inactive state
+	if (m_eBreak) {
+		GPIO_Init.Pin  = m_uBreakPin;
+		GPIO_Init.Mode = GPIO_MODE_INPUT;
+		GPIO_Init.Pull = (m_eBreakPolarity == QAD_PWM_Break_ActiveLow) ? GPIO_PULLUP : GPIO_PULLDOWN;
+		HAL_GPIO_Init(m_pBreakGPIO, &GPIO_Init);
+	}
+
 	//Enable Timer Clock
 	QAD_TimerMgr::enableClock(m_eTimer);
 
@@ -170,9 +683,14 @@ QA_Result QAD_PWM::periphInit(void) {
 	m_sHandle.Instance                     = QAD_TimerMgr::getInstance(m_eTimer);  //Set instance for required timer peripheral
 	m_sHandle.Init.Prescaler               = m_uPrescaler;                         //Set timer prescaler
 	m_sHandle.Init.Period                  = m_uPeriod;                            //Set timer counter period
-	m_sHandle.Init.CounterMode             = TIM_COUNTERMODE_UP;                   //Set counter mode to up
 	m_sHandle.Init.ClockDivision           = TIM_CLOCKDIVISION_DIV1;               //Unused
-	m_sHandle.Init.RepetitionCounter       = 0x0;                                  //
+	if (m_eCounterMode == QAD_PWM_CenterAligned) {
+		m_sHandle.Init.CounterMode           = TIM_COUNTERMODE_CENTERALIGNED1;       //Set counter mode to count up then down
+		m_sHandle.Init.RepetitionCounter     = 0x1;                                  //Single update event per PWM period (advanced-control timers only)
+	} else {
+		m_sHandle.Init.CounterMode           = TIM_COUNTERMODE_UP;                   //Set counter mode to up
+		m_sHandle.Init.RepetitionCounter     = 0x0;                                  //
+	}
 	m_sHandle.Init.AutoReloadPreload       = TIM_AUTORELOAD_PRELOAD_ENABLE;        //Enable preload of the timer's auto-reload register
 
   //Initialize Timer in PWM mode, performing a partial deinitialization if the initialization fails
@@ -182,6 +700,9 @@ QA_Result QAD_PWM::periphInit(void) {
 	}
 
 	//Init PWM Channels
+	//When complementary outputs, dead time or the break input are used, both outputs of each channel are set to idle low so that
+	//neither side of a half-bridge is driven while outputs are disabled
+	bool bAdvanced = getAdvancedUsed();
 	TIM_OC_InitTypeDef TIM_OC_Init;
 	//Iterate through number of channels supported by selected timer peripheral
 	for (uint8_t i=0; i<QAD_TimerMgr::getChannels(m_eTimer); i++) {
@@ -189,10 +710,12 @@ QA_Result QAD_PWM::periphInit(void) {
 		if (m_sChannels[i].eActive) {
 			TIM_OC_Init = {0};
 			TIM_OC_Init.OCMode        = TIM_OCMODE_PWM1;        //Set Output Compare mode to PWM1
-			TIM_OC_Init.OCIdleState   = TIM_OCIDLESTATE_SET;    //Set Output Compare Idle State to Set
+			TIM_OC_Init.OCIdleState   = bAdvanced ? TIM_OCIDLESTATE_RESET : TIM_OCIDLESTATE_SET;  //Set Output Compare Idle State
 			TIM_OC_Init.Pulse         = 0;                      //
 			TIM_OC_Init.OCPolarity    = TIM_OCPOLARITY_HIGH;    //Set Output Compare Polarity to High
 			TIM_OC_Init.OCFastMode    = TIM_OCFAST_ENABLE;      //Enable Output Compare Fast Mode
+			TIM_OC_Init.OCNPolarity   = TIM_OCNPOLARITY_HIGH;   //Set complementary output polarity to High
+			TIM_OC_Init.OCNIdleState  = TIM_OCNIDLESTATE_RESET; //Set complementary output Idle State to Reset
 
 			//Configure PWM Channel, performing a full deinitialization if the configuration fails
 			if (HAL_TIM_PWM_ConfigChannel(&m_sHandle, &TIM_OC_Init, m_uChannelSelect[i]) != HAL_OK) {
@@ -202,6 +725,47 @@ QA_Result QAD_PWM::periphInit(void) {
 		}
 	}
 
+	//Init Dead Time and Break Input
+	if (bAdvanced) {
+		TIM_BreakDeadTimeConfigTypeDef TIM_BDT_Init = {0};
+		TIM_BDT_Init.OffStateRunMode  = TIM_OSSR_ENABLE;                                          //Drive disabled outputs to their inactive level
+		TIM_BDT_Init.OffStateIDLEMode = TIM_OSSI_ENABLE;                                          //Drive outputs to their idle level when MOE is cleared
+		TIM_BDT_Init.LockLevel        = TIM_LOCKLEVEL_OFF;                                        //
+		TIM_BDT_Init.DeadTime         = calcDeadTime(QAD_TimerMgr::getClockSpeed(m_eTimer), m_uDeadTime_ns);
+		TIM_BDT_Init.BreakState       = m_eBreak ? TIM_BREAK_ENABLE : TIM_BREAK_DISABLE;          //Enable break input if required
+		TIM_BDT_Init.BreakPolarity    = (m_eBreakPolarity == QAD_PWM_Break_ActiveLow) ? TIM_BREAKPOLARITY_LOW : TIM_BREAKPOLARITY_HIGH;
+		TIM_BDT_Init.AutomaticOutput  = TIM_AUTOMATICOUTPUT_DISABLE;                              //Outputs are only re-enabled by clearBreak()
+
+		if (HAL_TIMEx_ConfigBreakDeadTime(&m_sHandle, &TIM_BDT_Init) != HAL_OK) {
+			periphDeinit(DeinitFull);
+			return QA_Fail;
+		}
+	}
+
+	//Clear any break flag left from a previous use of the timer, so that start() is only refused for breaks occurring after initialization
+	if (QAD_TimerMgr::getAdvanced(m_eTimer))
+		__HAL_TIM_CLEAR_FLAG(&m_sHandle, TIM_FLAG_BREAK);
+
+	//Init Stream DMA Channel
+	if (m_eStream) {
+		m_sDMA.Instance                 = QAD_DMAMgr::getInstance(m_eStreamDMA);  //Set instance for DMA channel
+		m_sDMA.Init.Direction           = DMA_MEMORY_TO_PERIPH;                   //Transfer from buffer to timer DMA burst register
+		m_sDMA.Init.PeriphInc           = DMA_PINC_DISABLE;                       //Timer DMA burst register address is fixed
+		m_sDMA.Init.MemInc              = DMA_MINC_ENABLE;                        //Increment through buffer
+		m_sDMA.Init.PeriphDataAlignment = DMA_PDATAALIGN_WORD;                    //32bit DMA burst register, with 16bit values zero extended
+		m_sDMA.Init.MemDataAlignment    = DMA_MDATAALIGN_HALFWORD;                //16bit buffer entries
+		m_sDMA.Init.Mode                = DMA_NORMAL;                             //Mode is set when each stream is started
+		m_sDMA.Init.Priority            = DMA_PRIORITY_HIGH;                      //
+
+		if (HAL_DMA_Init(&m_sDMA) != HAL_OK) {
+			periphDeinit(DeinitFull);
+			return QA_Fail;
+		}
+
+		//Set DMA IRQ priority. IRQ is enabled in startStream()
+		HAL_NVIC_SetPriority(QAD_DMAMgr::getIRQ(m_eStreamDMA), m_uStreamIRQPriority, 0x00);
+	}
+
 	//Set Driver States
 	m_eInitState = QA_Initialized; //Set driver state as initialized
 	m_eState     = QA_Inactive;    //Set driver as currently inactive
@@ -223,6 +787,14 @@ void QAD_PWM::periphDeinit(QAD_PWM::DeinitMode eDeinitMode) {
 	//Check if a full deinitialization is required
 	if (eDeinitMode) {
 
+		//Stop any active stream, release dither pattern and deinitialize DMA channel
+		stopStream();
+		m_pDitherBuffer.reset();
+		if (m_sDMA.Instance) {
+			HAL_DMA_DeInit(&m_sDMA);
+			m_sDMA.Instance = NULL;
+		}
+
 		//Deinitialize Timer Peripheral
 		HAL_TIM_PWM_DeInit(&m_sHandle);
 
@@ -233,9 +805,14 @@ void QAD_PWM::periphDeinit(QAD_PWM::DeinitMode eDeinitMode) {
 
 	//Deinitialize GPIOs
 	for (uint8_t i=0; i<QAD_TimerMgr::getChannels(m_eTimer); i++) {
-		if (m_sChannels[i].eActive)
+		if (m_sChannels[i].eActive) {
 			HAL_GPIO_DeInit(m_sChannels[i].pGPIO, m_sChannels[i].uPin);
+			if (m_sChannels[i].eComplementary)
+				HAL_GPIO_DeInit(m_sChannels[i].pGPION, m_sChannels[i].uPinN);
+		}
 	}
+	if (m_eBreak)
+		HAL_GPIO_DeInit(m_pBreakGPIO, m_uBreakPin);
 
 	//Set Driver States
 	m_eState     = QA_Inactive;        //Set driver as currently inactive
@@ -243,5 +820,79 @@ void QAD_PWM::periphDeinit(QAD_PWM::DeinitMode eDeinitMode) {
 }
 
 
+//QAD_PWM::getAdvancedUsed
+//QAD_PWM Private Initialization Method
+//
+//Returns true if any of the features requiring an advanced-control timer (complementary outputs, dead time or break input) are used
+bool QAD_PWM::getAdvancedUsed(void) {
+	if ((m_uDeadTime_ns) || (m_eBreak))
+		return true;
+
+	for (uint8_t i=0; i<QAD_PWM_CHANNEL_COUNT; i++) {
+		if ((m_sChannels[i].eActive) && (m_sChannels[i].eComplementary))
+			return true;
+	}
+	return false;
+}
+
+
+  //----------------------------
+  //----------------------------
+  //QAD_PWM Private Data Methods
+
+//QAD_PWM::calcPeriod
+//QAD_PWM Private Data Method
+//
+//Used to find the prescaler and period for a PWM frequency using QAD_TimerMgr::calcFrequency(), which are stored if found
+//In center-aligned mode each PWM period is 2*period timer ticks, so the solver is used to find the number of ticks in each half of the
+//PWM period, which is then used directly as the period (rather than the period plus one as in edge-aligned mode)
+//uFrequency  - The required PWM frequency in Hz
+//uResolution - The minimum number of timer ticks per PWM period, or per half of the PWM period in center-aligned mode
+//Returns true if a prescaler and period have been found, or false if the frequency cannot be produced at the required resolution
+bool QAD_PWM::calcPeriod(uint32_t uFrequency, uint32_t uResolution) {
+	if (m_eCounterMode == QAD_PWM_CenterAligned) {
+		QAD_Timer_FreqConfig sConfig = QAD_TimerMgr::calcFrequency(m_eTimer, uFrequency * 2, uResolution);
+		uint32_t uMaxPeriod = (QAD_TimerMgr::getType(m_eTimer) == QAD_Timer_32bit) ? 0xFFFFFFFF : 0xFFFF;
+		if ((!sConfig.bValid) || (sConfig.uPeriod >= uMaxPeriod))
+			return false;
+
+		m_uPrescaler = sConfig.uPrescaler;
+		m_uPeriod    = sConfig.uPeriod + 1;
+		return true;
+	}
+
+	QAD_Timer_FreqConfig sConfig = QAD_TimerMgr::calcFrequency(m_eTimer, uFrequency, uResolution);
+	if (!sConfig.bValid)
+		return false;
+
+	m_uPrescaler = sConfig.uPrescaler;
+	m_uPeriod    = sConfig.uPeriod;
+	return true;
+}
 
 
+  //------------------------------
+  //------------------------------
+  //QAD_PWM Private Dither Methods
+
+//QAD_PWM::fillDither
+//QAD_PWM Private Dither Method
+//
+//Calculates the dither pattern of a channel using a first-order sigma-delta modulator
+//The channel's value is scaled to the PWM period as a whole number of ticks and a 16bit fraction. The fraction is added to an accumulator
+//each period, with the compare value being one tick higher in each period that the accumulator overflows. The accumulator starts at one
+//half so that the number of higher periods is rounded to nearest, and the higher periods are spread evenly to minimise output ripple
+//uChannel - Index of the channel, which must be within the range of channels updated by the DMA burst
+void QAD_PWM::fillDither(uint8_t uChannel) {
+	uint16_t* pBuffer = &m_pDitherBuffer[uChannel - m_uStreamFirst];
+	uint32_t  uScaled = (uint32_t)m_uDitherVals[uChannel] * getPeriodTicks();
+	uint16_t  uWhole  = (uint16_t)(uScaled >> 16);
+	uint32_t  uFrac   = uScaled & 0xFFFF;
+	uint32_t  uAcc    = 0x8000;
+
+	for (uint32_t i=0; i<QAD_PWM_DITHER_PERIODS; i++) {
+		uAcc += uFrac;
+		pBuffer[i * m_uStreamChannels] = uWhole + (uint16_t)(uAcc >> 16);
+		uAcc &= 0xFFFF;
+	}
+}
@@ -22,7 +22,11 @@
 //Includes
 #include "setup.hpp"
 
+#include <memory>
+
 #include "QAD_TimerMgr.hpp"
+#include "QAD_DMAMgr.hpp"
+#include "QAT_Delegate.hpp"
 
 
 	//------------------------------------------
@@ -30,7 +34,7 @@
 	//------------------------------------------
 
 
-//NOTE: To determine how many PWM channels are supported by a specific timer peripheral, check the QAD_TimerMgr() constructor in QAD_TimerMgr.cpp, or
+//NOTE: To determine how many PWM channels are supported by a specific timer peripheral, check the m_sTimers table in QAD_TimerMgr.hpp, or
 //alternatively check the reference documentation for the STM32F103C6 device.
 
 
@@ -41,6 +45,14 @@
 #define QAD_PWM_CHANNEL_COUNT   4
 
 
+//----------------------
+//QAD_PWM_DITHER_PERIODS
+//
+//Number of PWM periods in the repeating pattern used by dithering mode. Each channel's average duty cycle can be set in steps of
+//1/QAD_PWM_DITHER_PERIODS of a timer tick, adding 5 bits to the resolution of the PWM period
+#define QAD_PWM_DITHER_PERIODS  32
+
+
 //---------------
 //QAD_PWM_Channel
 //
@@ -54,6 +66,63 @@ enum QAD_PWM_Channel : uint8_t {
 };
 
 
+//-------------------
+//QAD_PWM_CounterMode
+//
+//Enum used to select the alignment of the PWM signals
+enum QAD_PWM_CounterMode : uint8_t {
+	QAD_PWM_EdgeAligned = 0,  //Counter counts up, so all channels switch on together at the start of each PWM period
+	QAD_PWM_CenterAligned     //Counter counts up then down, so pulses of all channels are centred on the same point of each PWM period
+	                          //Each PWM period is twice the counter period, so the PWM frequency is halved for the same prescaler and period
+};
+
+
+//------------------
+//QAD_PWM_StreamMode
+//
+//Enum used to select how the buffer passed to QAD_PWM::startStream() is streamed
+enum QAD_PWM_StreamMode : uint8_t {
+	QAD_PWM_StreamSingle = 0,  //Buffer is streamed once, after which the final compare values continue to be output
+	QAD_PWM_StreamCircular     //Buffer is streamed continuously, with a callback as each half is completed so that it can be refilled
+};
+
+
+//-------------------
+//QAD_PWM_StreamEvent
+//
+//Used to indicate which part of the stream buffer has been completed when the stream callback is called
+enum QAD_PWM_StreamEvent : uint8_t {
+	QAD_PWM_Stream_HalfFirst = 0,  //Circular mode - First half of the buffer has been transferred and can be refilled
+	QAD_PWM_Stream_HalfSecond,     //Circular mode - Second half of the buffer has been transferred and can be refilled
+	QAD_PWM_Stream_Complete        //Single mode - The whole buffer has been transferred and the stream has stopped
+};
+
+
+//-------------------
+//QAD_PWM_StreamBlock
+//
+//Structure passed as the pData parameter of the stream callback each time part of the stream buffer has been completed
+typedef struct {
+
+	QAD_PWM_StreamEvent eEvent;     //Which part of the buffer has been completed. Member of QAD_PWM_StreamEvent
+
+	uint16_t*           pValues;    //Pointer to the completed part of the stream buffer
+	uint32_t            uPeriods;   //Number of PWM periods in the completed part of the buffer
+	uint8_t             uChannels;  //Number of compare values per PWM period
+
+} QAD_PWM_StreamBlock;
+
+
+//---------------------
+//QAD_PWM_BreakPolarity
+//
+//Enum used to select the active level of the break input of an advanced-control timer
+enum QAD_PWM_BreakPolarity : uint8_t {
+	QAD_PWM_Break_ActiveLow = 0,  //Outputs are disabled when the break input is low. The break input pin has its pull-up resistor enabled
+	QAD_PWM_Break_ActiveHigh      //Outputs are disabled when the break input is high. The break input pin has its pull-down resistor enabled
+};
+
+
 //--------------------------
 //QAD_PWM_Channel_InitStruct
 //
@@ -67,6 +136,11 @@ typedef struct QAD_PWM_Channel_InitStruct {
 	uint16_t       uPin;     //Pin number to be used by this PWM channel
 	//uint8_t        uAF;      //Alternate function used to connect the GPIO pin to the respective timer peripheral
 
+	QA_ActiveState eComplementary;  //Set to QA_Active to enable the complementary output (CHxN) of this PWM channel
+	                                //Only supported by channels 1 to 3 of advanced-control timers (Timer 1)
+	GPIO_TypeDef*  pGPION;          //GPIO port to be used by the complementary output
+	uint16_t       uPinN;           //Pin number to be used by the complementary output
+
 
 	//Assignment operator definition to allow easy copying of channel data from QAD_PWM_InitStruct to
 	//members of m_sChannels array in QAD_PWM driver class
@@ -75,6 +149,9 @@ typedef struct QAD_PWM_Channel_InitStruct {
 		pGPIO     = other.pGPIO;
 		uPin      = other.uPin;
 		//uAF       = other.uAF;
+		eComplementary = other.eComplementary;
+		pGPION         = other.pGPION;
+		uPinN          = other.uPinN;
 		return *this;
 	}
 
@@ -92,10 +169,25 @@ typedef struct {
 	uint32_t          uPrescaler;   //Prescaler to be used for the selected timer
 	uint32_t          uPeriod;      //Counter period to be used for the selected timer
 
+	QAD_PWM_CounterMode eCounterMode;  //Alignment of the PWM signals. Member of QAD_PWM_CounterMode
+
 	QAD_PWM_Channel_InitStruct sChannels[QAD_PWM_CHANNEL_COUNT];  //Data for individual PWM channels
 	                                                              //Note that although four channels worth of init data can be supplied, the selected
 	                                                              //timer peripheral may support less than four channels
 
+	QA_ActiveState    eStream;             //Set to QA_Active to allow compare values to be streamed by DMA using startStream()
+	                                       //This claims the timer's update DMA channel (see QAD_TimerMgr.hpp) when the driver is initialized
+	uint8_t           uStreamIRQPriority;  //IRQ Priority for the stream DMA interrupt (a value between 0 and 15)
+
+	//The following are only supported by advanced-control timers (Timer 1)
+	uint32_t          uDeadTime_ns;        //Dead time in nanoseconds inserted between each output and its complementary output switching on
+	                                       //Rounded up to the next step supported by the dead-time generator (maximum of 1008 timer clock cycles)
+	                                       //Must be non-zero when any channel uses a complementary output, otherwise init() fails
+	QA_ActiveState    eBreak;              //Set to QA_Active to enable the break input, which disables all outputs in hardware when asserted
+	QAD_PWM_BreakPolarity eBreakPolarity;  //Active level of the break input. Member of QAD_PWM_BreakPolarity
+	GPIO_TypeDef*     pBreakGPIO;          //GPIO port to be used by the break input (BKIN)
+	uint16_t          uBreakPin;           //Pin number to be used by the break input
+
 } QAD_PWM_InitStruct;
 
 
@@ -108,6 +200,28 @@ typedef struct {
 //
 //Driver class used for generating PWM signals on between one and four channels
 //Note that the number of available channels is determined by the number of channels supported by the selected timer peripheral
+//
+//When streaming is enabled, compare values can be fed from a buffer by the timer's update DMA request, so a new duty cycle can be output
+//every PWM period with no CPU involvement (such as for WS2812 addressable LEDs or arbitrary waveforms). The DMA burst feature is used to
+//update the compare registers of all channels from the lowest to the highest active channel on each update event, so the buffer holds
+//interleaved compare values, one for each of these channels per PWM period. As compare registers are preloaded, each set of values is
+//output from the PWM period following the one in which it was transferred.
+//
+//The handler() method is to be called by the IRQ handler function of the timer's update DMA channel within handlers.cpp
+//In center-aligned mode, general purpose timers generate an update event at both ends of the count, so a set of stream values is
+//transferred every half PWM period. For advanced-control timers the repetition counter is used to keep one update event per PWM period
+//
+//When used with an advanced-control timer (Timer 1), channels 1 to 3 can also drive complementary outputs for half-bridges, with dead time
+//inserted by hardware and a break input that disables all outputs in hardware. When any of these features are used, both outputs of each
+//channel are driven low whenever the outputs are disabled by a break, emergencyStop() or stop(). After a break, clearBreak() is required to
+//re-enable the outputs, and start() is refused while a break is latched, so they never restart automatically. A non-zero dead time is
+//required whenever complementary outputs are used.
+//
+//Dithering mode uses the stream DMA to increase the resolution of the average duty cycle, such as for precision analog outputs through RC
+//filters. Each channel is set with a 16bit value, and a first-order sigma-delta modulator spreads its fractional part over a repeating
+//pattern of QAD_PWM_DITHER_PERIODS periods, with the compare value alternating between the two nearest timer ticks. For example at 20kHz
+//from a 72MHz timer clock the period of 3600 ticks gives under 12 bits per period, but 115200 steps when averaged over the pattern. The
+//pattern is only recalculated when a value is changed, and its DMA interrupts are disabled, so no CPU time is used per PWM period.
 class QAD_PWM {
 private:
 
@@ -128,11 +242,37 @@ private:
   uint32_t           m_uPrescaler;  //Prescaler to be used for selected timer
   uint32_t           m_uPeriod;     //Counter period to be used for selected timer
 
+  QAD_PWM_CounterMode m_eCounterMode;  //Alignment of the PWM signals. Member of QAD_PWM_CounterMode
+
   QAD_PWM_Channel_InitStruct m_sChannels[QAD_PWM_CHANNEL_COUNT];  //Array of channel specific data
                                                                   //See QAD_PWM_Channel_InitStruct for more details
 
   uint32_t           m_uChannelSelect[QAD_PWM_CHANNEL_COUNT];     //Array used to select TIM_Channel defines as defined in stm32f1xx_hal_tim.h
 
+  QA_ActiveState     m_eStream;             //Stores whether DMA streaming is enabled for the driver
+  uint8_t            m_uStreamIRQPriority;  //IRQ Priority for the stream DMA interrupt
+  QAD_DMA_Channel    m_eStreamDMA;          //DMA channel used for streaming (the timer's update DMA channel)
+  DMA_HandleTypeDef  m_sDMA;                //Handle used by HAL functions to access the DMA channel (defined in stm32f1xx_hal_dma.h)
+
+  QA_ActiveState     m_eStreamState;        //Stores whether a stream is currently active
+  QAD_PWM_StreamMode m_eStreamMode;         //Mode of the current stream. Member of QAD_PWM_StreamMode
+  uint16_t*          m_pStreamBuffer;       //Buffer of the current stream
+  uint32_t           m_uStreamPeriods;      //Number of PWM periods in the buffer of the current stream
+  uint8_t            m_uStreamFirst;        //Index of the first channel updated by the DMA burst
+  uint8_t            m_uStreamChannels;     //Number of channels updated by the DMA burst (compare values per PWM period)
+
+  QAT_Delegate       m_sStreamHandler;      //Callback delegate to be called as parts of the stream buffer are completed (QAT_Delegate defined in QAT_Delegate.hpp)
+
+  QA_ActiveState     m_eDitherState;        //Stores whether dithering mode is currently active
+  std::unique_ptr<uint16_t[]> m_pDitherBuffer;  //Circular stream buffer holding the dither pattern
+  uint16_t           m_uDitherVals[QAD_PWM_CHANNEL_COUNT];  //16bit dither value of each channel
+
+  uint32_t           m_uDeadTime_ns;        //Dead time in nanoseconds inserted between complementary outputs
+  QA_ActiveState     m_eBreak;              //Stores whether the break input is enabled
+  QAD_PWM_BreakPolarity m_eBreakPolarity;   //Active level of the break input
+  GPIO_TypeDef*      m_pBreakGPIO;          //GPIO port used by the break input
+  uint16_t           m_uBreakPin;           //Pin number used by the break input
+
 public:
 
   //--------------------------
@@ -146,11 +286,38 @@ public:
 		m_eTimer(sInit.eTimer),
 		m_sHandle({0}),
 		m_uPrescaler(sInit.uPrescaler),
-		m_uPeriod(sInit.uPeriod) {
+		m_uPeriod(sInit.uPeriod),
+		m_eCounterMode(sInit.eCounterMode),
+		m_eStream(sInit.eStream),
+		m_uStreamIRQPriority(sInit.uStreamIRQPriority),
+		m_eStreamDMA(QAD_DMA_ChannelNone),
+		m_sDMA({0}),
+		m_eStreamState(QA_Inactive),
+		m_eStreamMode(QAD_PWM_StreamSingle),
+		m_pStreamBuffer(NULL),
+		m_uStreamPeriods(0),
+		m_uStreamFirst(0),
+		m_uStreamChannels(0),
+		m_sStreamHandler(),
+		m_eDitherState(QA_Inactive),
+		m_pDitherBuffer(nullptr),
+		m_uDitherVals(),
+		m_uDeadTime_ns(sInit.uDeadTime_ns),
+		m_eBreak(sInit.eBreak),
+		m_eBreakPolarity(sInit.eBreakPolarity),
+		m_pBreakGPIO(sInit.pBreakGPIO),
+		m_uBreakPin(sInit.uBreakPin) {
 
   	//Copy channel specific data from initialization structure to m_sChannels array in QAD_PWM class
+  	//The range of active channels is also found, to be updated by the stream DMA burst
   	for (uint8_t i=0; i<QAD_PWM_CHANNEL_COUNT; i++) {
   		m_sChannels[i] = sInit.sChannels[i];
+
+  		if ((m_sChannels[i].eActive) && (i < QAD_TimerMgr::getChannels(m_eTimer))) {
+  			if (!m_uStreamChannels)
+  				m_uStreamFirst = i;
+  			m_uStreamChannels = (i - m_uStreamFirst) + 1;
+  		}
   	}
 
   	//Fill out m_uChannelSelect array with TIM_Channel defines
@@ -160,6 +327,12 @@ public:
   	m_uChannelSelect[QAD_PWM_Channel_4] = TIM_CHANNEL_4;
   }
 
+  QAD_PWM(QAD_PWM_InitStruct& sInit, uint32_t uFrequency, uint32_t uResolution) :  //Constructor to set the PWM frequency in Hz and minimum resolution in
+  	QAD_PWM(sInit) {                                                               //timer ticks, with uPrescaler and uPeriod of the initialization structure
+                                                                                   //only being used if the frequency cannot be produced
+  	calcPeriod(uFrequency, uResolution);
+  }
+
   ~QAD_PWM() {        //Destructor to make sure peripheral is made inactive and deinitialized upon class destruction
 
   	//Stop PWM driver if currently active
@@ -181,13 +354,73 @@ public:
   void deinit(void);
 
 
+  //-------------------
+  //IRQ Handler Methods
+
+  void handler(void);
+
+
   //---------------
   //Control Methods
 
-  void start(void);
+  QA_Result start(void);
   void stop(void);
 
   void setPWMVal(QAD_PWM_Channel eChannel, uint16_t uVal);
+  void setPWMVals(const uint16_t* pVals);
+
+  QA_Result setFrequency(uint32_t uFrequency, uint32_t uResolution);
+  uint32_t getFrequency(void);
+  uint32_t getPeriod(void);
+
+
+  //--------------
+  //Stream Methods
+
+  void setStreamHandler(const QAT_Delegate& sHandler);
+
+  QA_Result startStream(uint16_t* pBuffer, uint32_t uPeriods, QAD_PWM_StreamMode eMode);
+  void stopStream(void);
+
+  QA_ActiveState getStreamState(void);
+
+
+  //--------------
+  //Dither Methods
+
+  void setDitherVal(QAD_PWM_Channel eChannel, uint16_t uVal);
+
+  QA_Result startDither(void);
+  void stopDither(void);
+
+  QA_ActiveState getDitherState(void);
+
+
+  //-------------
+  //Break Methods
+
+  void emergencyStop(void);
+  QA_ActiveState getBreakState(void);
+  QA_Result clearBreak(void);
+
+
+  //-----------------
+  //Dead Time Methods
+
+  //Used to calculate the dead-time generator setting (DTG bits of TIMx_BDTR) for a dead time, rounding up to the next supported step
+  //The dead-time generator counts in steps of the timer clock for up to 127 steps, and then in steps of 2, 8 and 16 timer clocks
+  //As this method is constexpr, it can be used in static_assert() to check a dead time at compile time
+  //uClockSpeed  - The timer clock speed in Hz (see QAD_TimerMgr::getClockSpeed())
+  //uDeadTime_ns - The required dead time in nanoseconds
+  //Returns the DTG setting, saturated at 0xFF (1008 timer clocks) if the dead time is too long
+  static constexpr uint8_t calcDeadTime(uint32_t uClockSpeed, uint32_t uDeadTime_ns) {
+  	uint32_t uTicks = (uint32_t)((((uint64_t)uDeadTime_ns * uClockSpeed) + 999999999ULL) / 1000000000ULL);
+
+  	return (uTicks <= 127)  ? (uint8_t)uTicks :
+  	       (uTicks <= 254)  ? (uint8_t)(0x80 | (((uTicks + 1) / 2) - 64)) :
+  	       (uTicks <= 504)  ? (uint8_t)(0xC0 | (((uTicks + 7) / 8) - 32)) :
+  	       (uTicks <= 1008) ? (uint8_t)(0xE0 | (((uTicks + 15) / 16) - 32)) : 0xFF;
+  }
 
 private:
 
@@ -197,8 +430,33 @@ private:
   QA_Result periphInit(void);
   void periphDeinit(DeinitMode eDeinitMode);
 
+  bool getAdvancedUsed(void);
+
+
+  //----------------------
+  //Private Dither Methods
+
+  void fillDither(uint8_t uChannel);
+
+
+  //--------------------
+  //Private Data Methods
+
+  bool calcPeriod(uint32_t uFrequency, uint32_t uResolution);
+
+  //Returns the number of timer ticks in each PWM period, or in each half of the PWM period in center-aligned mode, which is the full scale
+  //compare value. In center-aligned mode the counter counts from 0 up to the period and back down to 0, so each half is the period itself
+  uint32_t getPeriodTicks(void) {
+  	return (m_eCounterMode == QAD_PWM_CenterAligned) ? m_uPeriod : (m_uPeriod + 1);
+  }
+
 };
 
 
+//Compile time checks of dead-time generator encoding
+static_assert(QAD_PWM::calcDeadTime(72000000, 1000) == 72, "QAD_PWM::calcDeadTime() failed for 1us at 72MHz");
+static_assert(QAD_PWM::calcDeadTime(72000000, 2000) == (0x80 | 8), "QAD_PWM::calcDeadTime() failed for 2us at 72MHz");
+
+
 //Prevent Recursive Inclusion
 #endif /* __QAD_PWM_HPP_ */
@@ -0,0 +1,141 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: DMA Management Driver                                           */
+/*   Filename: QAD_DMAMgr.cpp                                              */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_DMAMgr.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+  //----------------------
+	//----------------------
+	//QAD_DMAMgr Data Tables
+
+//QAD_DMAMgr::m_sChannels
+//QAD_DMAMgr Descriptor Table
+//
+//Definition of constexpr descriptor table declared within QAD_DMAMgr class, required for it to be indexed at runtime
+constexpr QAD_DMA_Desc QAD_DMAMgr::m_sChannels[QAD_DMA_ChannelCount];
+
+
+//QAD_DMAMgr::m_eStates
+//QAD_DMAMgr State Table
+//
+//Stores whether each DMA channel is in use. Zero initialized to QAD_DMA_Unused before main() is called
+QAD_DMA_State QAD_DMAMgr::m_eStates[QAD_DMA_ChannelCount] = {QAD_DMA_Unused};
+
+
+  //-----------------------------
+	//-----------------------------
+	//QAD_DMAMgr Management Methods
+
+//QAD_DMAMgr::registerChannel
+//QAD_DMAMgr Management Method
+//
+//Used to register a DMA channel as being used by a driver
+//eChannel - the DMA channel to be registered. A member of QAD_DMA_Channel
+//Returns QA_OK if registration is successful, or returns QA_Error_PeriphBusy if the selected DMA channel is already in use
+QA_Result QAD_DMAMgr::registerChannel(QAD_DMA_Channel eChannel) {
+	if (eChannel >= QAD_DMA_ChannelNone)
+		return QA_Fail;
+
+  if (m_eStates[eChannel])
+  	return QA_Error_PeriphBusy;
+
+  m_eStates[eChannel] = QAD_DMA_InUse;
+  return QA_OK;
+}
+
+
+//QAD_DMAMgr::deregisterChannel
+//QAD_DMAMgr Management Method
+//
+//Used to deregister a DMA channel to mark it as no longer being used by a driver
+//eChannel - the DMA channel to be deregistered. A member of QAD_DMA_Channel
+void QAD_DMAMgr::deregisterChannel(QAD_DMA_Channel eChannel) {
+	if (eChannel >= QAD_DMA_ChannelNone)
+		return;
+
+  m_eStates[eChannel] = QAD_DMA_Unused;
+}
+
+
+  //------------------------------
+  //------------------------------
+  //QAD_DMAMgr IRQ Handler Methods
+
+//QAD_DMAMgr::getBufferEvents
+//QAD_DMAMgr IRQ Handler Method
+//
+//Used by the IRQ handler methods of DMA drivers to find and clear the buffer events of a DMA channel
+//Each flag is only reported if its interrupt is enabled, as the hardware sets the half transfer flag halfway through every transfer
+//even when only the transfer complete interrupt is used (such as in single buffer modes)
+//pDMA - Handle of the DMA channel
+//Returns the events that have occurred, as a combination of QAD_DMA_Event flags. If both are set then the interrupt has been held off
+//        for longer than half of the buffer, and the half transfer event is to be processed first
+uint8_t QAD_DMAMgr::getBufferEvents(DMA_HandleTypeDef* pDMA) {
+	uint8_t uEvents = QAD_DMA_Event_None;
+
+	//Half Transfer
+	if ((__HAL_DMA_GET_IT_SOURCE(pDMA, DMA_IT_HT)) && (__HAL_DMA_GET_FLAG(pDMA, __HAL_DMA_GET_HT_FLAG_INDEX(pDMA)))) {
+		__HAL_DMA_CLEAR_FLAG(pDMA, __HAL_DMA_GET_HT_FLAG_INDEX(pDMA));
+		uEvents |= QAD_DMA_Event_Half;
+	}
+
+	//Transfer Complete
+	if ((__HAL_DMA_GET_IT_SOURCE(pDMA, DMA_IT_TC)) && (__HAL_DMA_GET_FLAG(pDMA, __HAL_DMA_GET_TC_FLAG_INDEX(pDMA)))) {
+		__HAL_DMA_CLEAR_FLAG(pDMA, __HAL_DMA_GET_TC_FLAG_INDEX(pDMA));
+		uEvents |= QAD_DMA_Event_Complete;
+	}
+
+	return uEvents;
+}
+
+
+  //-------------------------
+	//-------------------------
+	//QAD_DMAMgr Status Methods
+
+//QAD_DMAMgr::getChannelsActive
+//QAD_DMAMgr Status Method
+//
+//Returns the number of DMA channels that are currently in-use (registered/active)
+uint8_t QAD_DMAMgr::getChannelsActive(void) {
+  uint8_t uCount = 0;
+  for (uint8_t i=0; i<QAD_DMA_ChannelCount; i++) {
+  	if (m_eStates[i])
+  		uCount++;
+  }
+  return uCount;
+}
+
+
+//QAD_DMAMgr::getChannelsInactive
+//QAD_DMAMgr Status Method
+//
+//Returns the number of DMA channels that are currently not being used (deregistered/inactive)
+uint8_t QAD_DMAMgr::getChannelsInactive(void) {
+  uint8_t uCount = 0;
+  for (uint8_t i=0; i<QAD_DMA_ChannelCount; i++) {
+  	if (!m_eStates[i])
+  		uCount++;
+  }
+  return uCount;
+}
@@ -0,0 +1,214 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: DMA Management Driver                                           */
+/*   Filename: QAD_DMAMgr.hpp                                              */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_DMAMGR_HPP_
+#define __QAD_DMAMGR_HPP_
+
+//Includes
+#include "setup.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------------
+//QAD_DMA_Channel
+//
+//Used to select which DMA channel is to be used, and index into channel array in DMA manager
+//The STM32F103C6 has a single DMA controller (DMA1) with seven channels, each of which has a fixed set of peripheral requests mapped to it
+//(see the DMA1 request mapping table in the STM32F103 reference manual)
+enum QAD_DMA_Channel : uint8_t {
+	QAD_DMA1_Channel1 = 0,
+	QAD_DMA1_Channel2,
+	QAD_DMA1_Channel3,
+	QAD_DMA1_Channel4,
+	QAD_DMA1_Channel5,
+	QAD_DMA1_Channel6,
+	QAD_DMA1_Channel7,
+	QAD_DMA_ChannelNone
+};
+
+
+//-------------------
+//QAD_DMA_ChannelCount
+//
+//DMA Channel Count
+const uint8_t QAD_DMA_ChannelCount = QAD_DMA_ChannelNone;
+
+
+//-------------
+//QAD_DMA_State
+//
+//Used to store whether a particular DMA channel is in use, or not currently being used
+enum QAD_DMA_State : uint8_t {
+	QAD_DMA_Unused = 0,
+	QAD_DMA_InUse,
+	QAD_DMA_InvalidChannel
+};
+
+
+//-------------
+//QAD_DMA_Event
+//
+//Flags returned by QAD_DMAMgr::getBufferEvents() to indicate which parts of a DMA buffer have been completed
+enum QAD_DMA_Event : uint8_t {
+	QAD_DMA_Event_None     = 0x00,
+	QAD_DMA_Event_Half     = 0x01,   //Half transfer - First half of the buffer has been completed
+	QAD_DMA_Event_Complete = 0x02    //Transfer complete - Whole buffer (or second half in circular mode) has been completed
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------
+//QAD_DMA_Desc
+//
+//Structure used in constant table within QAD_DMAMgr class to hold the fixed hardware details of DMA channels
+//All members are known at compile time, so lookups with a constant DMA channel are folded to constants by the compiler
+typedef struct {
+
+	QAD_DMA_Channel       eChannel;   //Used to store which DMA channel is represented by the structure
+
+	uint32_t              uBase;      //Stores the base address of the DMA channel (DMA1_Channelx_BASE defined in stm32f103x6.h)
+	                                  //Stored as an address rather than a DMA_Channel_TypeDef pointer, as a pointer cast is not permitted in a constant expression
+
+	IRQn_Type             eIRQ;       //Stores the IRQ Handler enum for the DMA channel (defined in stm32f103x6.h)
+
+} QAD_DMA_Desc;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------
+//QAD_DMAMgr
+//
+//Static class
+//Used to allow management of DMA channels in order to make sure that a driver is prevented from accessing any
+//DMA channels that are already being used by another driver
+//Fixed hardware details are held in the constexpr m_sChannels table, and the in-use state of each DMA channel in the m_eStates array
+//The DMA1 controller clock is enabled by SystemInitialize() in boot.cpp
+class QAD_DMAMgr {
+private:
+
+	//DMA Channel Descriptors
+	static constexpr QAD_DMA_Desc m_sChannels[QAD_DMA_ChannelCount] = {
+
+		//eChannel           uBase               eIRQ
+		{QAD_DMA1_Channel1,  DMA1_Channel1_BASE, DMA1_Channel1_IRQn},
+		{QAD_DMA1_Channel2,  DMA1_Channel2_BASE, DMA1_Channel2_IRQn},
+		{QAD_DMA1_Channel3,  DMA1_Channel3_BASE, DMA1_Channel3_IRQn},
+		{QAD_DMA1_Channel4,  DMA1_Channel4_BASE, DMA1_Channel4_IRQn},
+		{QAD_DMA1_Channel5,  DMA1_Channel5_BASE, DMA1_Channel5_IRQn},
+		{QAD_DMA1_Channel6,  DMA1_Channel6_BASE, DMA1_Channel6_IRQn},
+		{QAD_DMA1_Channel7,  DMA1_Channel7_BASE, DMA1_Channel7_IRQn}
+	};
+
+	//DMA Channel States
+	static QAD_DMA_State m_eStates[QAD_DMA_ChannelCount];
+
+public:
+
+	//--------------------------------------------------------------------
+	//Delete constructors and assignment operator due to being a static class
+	QAD_DMAMgr() = delete;
+	QAD_DMAMgr(const QAD_DMAMgr& other) = delete;
+	QAD_DMAMgr& operator=(const QAD_DMAMgr& other) = delete;
+
+
+	//------------
+	//Data Methods
+
+	//Used to retrieve the current state (QAD_DMA_InUse, QAD_DMA_Unused) of a DMA channel
+	//eChannel - The DMA channel to retrieve the state for. Member of QAD_DMA_Channel
+	//Returns member of QAD_DMA_State enum
+	static QAD_DMA_State getState(QAD_DMA_Channel eChannel) {
+		if (eChannel >= QAD_DMA_ChannelNone)
+			return QAD_DMA_InvalidChannel;
+
+		return m_eStates[eChannel];
+	}
+
+	//Used to retrieve the base address of a DMA channel
+	//eChannel - The DMA channel to retrieve the base address for. Member of QAD_DMA_Channel
+	//Returns DMA1_Channelx_BASE as defined in stm32f103x6.h, or 0 if eChannel is invalid
+	static constexpr uint32_t getBase(QAD_DMA_Channel eChannel) {
+		return (eChannel < QAD_DMA_ChannelNone) ? m_sChannels[eChannel].uBase : 0;
+	}
+
+	//Used to retrieve an instance for a DMA channel
+	//eChannel - The DMA channel to retrieve the instance for. Member of QAD_DMA_Channel
+	//Returns DMA_Channel_TypeDef, as defined in stm32f103x6.h
+	static DMA_Channel_TypeDef* getInstance(QAD_DMA_Channel eChannel) {
+		if (eChannel >= QAD_DMA_ChannelNone)
+			return NULL;
+
+		return reinterpret_cast<DMA_Channel_TypeDef*>(m_sChannels[eChannel].uBase);
+	}
+
+	//Used to retrieve an IRQ enum for a DMA channel
+	//eChannel - The DMA channel to retrieve the IRQ enum for. Member of QAD_DMA_Channel
+	//Returns member of IRQn_Type enum, as defined in stm32f103x6.h
+	static constexpr IRQn_Type getIRQ(QAD_DMA_Channel eChannel) {
+		return (eChannel < QAD_DMA_ChannelNone) ? m_sChannels[eChannel].eIRQ : UsageFault_IRQn;
+	}
+
+
+	//NOTE: See QAD_DMAMgr.cpp for details of the following methods
+
+	//------------------
+	//Management Methods
+
+	static QA_Result registerChannel(QAD_DMA_Channel eChannel);
+	static void deregisterChannel(QAD_DMA_Channel eChannel);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	static uint8_t getBufferEvents(DMA_HandleTypeDef* pDMA);
+
+
+	//--------------
+	//Status Methods
+
+	static uint8_t getChannelsActive(void);
+	static uint8_t getChannelsInactive(void);
+
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Compile time checks of DMA channel descriptor table
+static_assert(QAD_DMAMgr::getBase(QAD_DMA1_Channel1) == DMA1_Channel1_BASE, "QAD_DMAMgr table entry for QAD_DMA1_Channel1 is out of order");
+static_assert(QAD_DMAMgr::getBase(QAD_DMA1_Channel7) == DMA1_Channel7_BASE, "QAD_DMAMgr table entry for QAD_DMA1_Channel7 is out of order");
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_DMAMGR_HPP_ */
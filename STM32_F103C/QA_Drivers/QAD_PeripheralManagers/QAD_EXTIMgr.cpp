@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: External Interrupt Manager                                      */
+/*   Filename: QAD_EXTIMgr.cpp                                             */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_EXTIMgr.hpp"
+
+#include "QAD_EXTI.hpp"
+#include "QAD_Timestamp.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+  //-----------------------
+  //-----------------------
+  //QAD_EXTIMgr Data Tables
+
+//QAD_EXTIMgr::m_pLines
+//QAD_EXTIMgr Line Table
+//
+//Stores the driver registered for each line. Zero initialized to nullptr before main() is called
+QAD_EXTI* QAD_EXTIMgr::m_pLines[QAD_EXTI_LineCount] = {nullptr};
+
+
+//QAD_EXTIMgr::m_pPorts
+//QAD_EXTIMgr Port Table
+//
+//Stores the GPIO port of each registered line
+GPIO_TypeDef* QAD_EXTIMgr::m_pPorts[QAD_EXTI_LineCount] = {nullptr};
+
+
+//QAD_EXTIMgr Capture Queue
+//
+//Mask of lines in capture mode, and the queue of captured edges. Zero initialized before main() is called
+uint32_t QAD_EXTIMgr::m_uCaptureLines = 0;
+QAT_Queue<QAD_EXTI_Event, QAD_EXTI_CAPTURE_SIZE> QAD_EXTIMgr::m_sEvents;
+
+
+  //------------------------------
+  //------------------------------
+  //QAD_EXTIMgr Management Methods
+
+//QAD_EXTIMgr::registerLine
+//QAD_EXTIMgr Management Method
+//
+//Used to register a driver to receive the interrupts of a line, enabling the line's IRQ if not already enabled
+//uLine   - The line number (0 to 15)
+//pDriver - The QAD_EXTI driver to be registered
+//pGPIO   - The GPIO port of the driver's pin
+//Returns QA_OK if registration is successful, or if the driver is already registered for the line
+//        QA_Fail if the line number is invalid
+//        QA_Error_PeriphBusy if the line is already in use by another driver
+QA_Result QAD_EXTIMgr::registerLine(uint8_t uLine, QAD_EXTI* pDriver, GPIO_TypeDef* pGPIO) {
+	if ((uLine >= QAD_EXTI_LineCount) || (!pDriver))
+		return QA_Fail;
+
+	if ((m_pLines[uLine]) && (m_pLines[uLine] != pDriver))
+		return QA_Error_PeriphBusy;
+
+	m_pLines[uLine] = pDriver;
+	m_pPorts[uLine] = pGPIO;
+
+	//Set IRQ priority and enable IRQ. QAD_IRQPRIORITY_EXTI is defined in setup.hpp
+	HAL_NVIC_SetPriority(getIRQ(uLine), QAD_IRQPRIORITY_EXTI, 0);
+	HAL_NVIC_EnableIRQ(getIRQ(uLine));
+	return QA_OK;
+}
+
+
+//QAD_EXTIMgr::deregisterLine
+//QAD_EXTIMgr Management Method
+//
+//Used to deregister a driver from a line, disabling the line's IRQ if no other line served by the IRQ remains registered
+//Has no effect if the line is registered to a different driver
+//uLine   - The line number (0 to 15)
+//pDriver - The QAD_EXTI driver to be deregistered
+void QAD_EXTIMgr::deregisterLine(uint8_t uLine, QAD_EXTI* pDriver) {
+	if ((uLine >= QAD_EXTI_LineCount) || (m_pLines[uLine] != pDriver))
+		return;
+
+	m_pLines[uLine]  = nullptr;
+	m_pPorts[uLine]  = nullptr;
+	m_uCaptureLines &= ~(1UL << uLine);
+
+	//Disable IRQ if no other lines served by it are in use
+	uint32_t uLines = getIRQLines(uLine);
+	for (uint8_t i=0; i<QAD_EXTI_LineCount; i++) {
+		if ((uLines & (1UL << i)) && (m_pLines[i]))
+			return;
+	}
+	HAL_NVIC_DisableIRQ(getIRQ(uLine));
+}
+
+
+  //---------------------------
+  //---------------------------
+  //QAD_EXTIMgr Capture Methods
+
+//QAD_EXTIMgr::setCapture
+//QAD_EXTIMgr Capture Method
+//
+//Used to set whether a line is in capture mode, in which its edges are recorded into the capture queue instead of being routed to its driver
+//uLine    - The line number (0 to 15)
+//eCapture - Set to QA_Active to enable capture mode, or QA_Inactive to route edges to the driver
+void QAD_EXTIMgr::setCapture(uint8_t uLine, QA_ActiveState eCapture) {
+	if (uLine >= QAD_EXTI_LineCount)
+		return;
+
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	if (eCapture)
+		m_uCaptureLines |= (1UL << uLine);
+	else
+		m_uCaptureLines &= ~(1UL << uLine);
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+//QAD_EXTIMgr::readEvents
+//QAD_EXTIMgr Capture Method
+//
+//Used to read a batch of events from the capture queue, oldest first. This is only to be called from a single context, such as the main loop
+//pEvents - Buffer to copy the events into
+//uMax    - Maximum number of events to be read (size of pEvents)
+//Returns the number of events read
+uint32_t QAD_EXTIMgr::readEvents(QAD_EXTI_Event* pEvents, uint32_t uMax) {
+	return m_sEvents.read(pEvents, uMax);
+}
+
+
+//QAD_EXTIMgr::getEventCount
+//QAD_EXTIMgr Capture Method
+//
+//Returns the number of events waiting in the capture queue
+uint32_t QAD_EXTIMgr::getEventCount(void) {
+	return m_sEvents.getCount();
+}
+
+
+//QAD_EXTIMgr::getDropped
+//QAD_EXTIMgr Capture Method
+//
+//Returns the number of events dropped due to the capture queue being full since clearEvents() was last called
+uint32_t QAD_EXTIMgr::getDropped(void) {
+	return m_sEvents.getDropped();
+}
+
+
+//QAD_EXTIMgr::clearEvents
+//QAD_EXTIMgr Capture Method
+//
+//Used to discard all events in the capture queue and clear the dropped event count
+void QAD_EXTIMgr::clearEvents(void) {
+	m_sEvents.clear();
+}
+
+
+  //-------------------------------
+  //-------------------------------
+  //QAD_EXTIMgr IRQ Handler Methods
+
+//QAD_EXTIMgr::dispatch
+//QAD_EXTIMgr IRQ Handler Method
+//
+//This method is only to be called by the external interrupt IRQ handler functions from handlers.cpp
+//All pending lines of the IRQ are cleared before any driver is called, so an edge that occurs during a driver's callback triggers a
+//further interrupt rather than being lost. Lines in capture mode are recorded into the capture queue first, all with the cycle count
+//taken on entry, and remaining lines are then routed to their drivers. Lines are served from highest to lowest using count-leading-zeros
+//bit scanning
+//uLines - Mask of the lines served by the IRQ (QAD_EXTI_LINES_x)
+void QAD_EXTIMgr::dispatch(uint32_t uLines) {
+	uint32_t uCycles  = QAD_Timestamp::getCycles();
+	uint32_t uPending = EXTI->PR & uLines;
+	EXTI->PR = uPending;
+
+	//Record edges of lines in capture mode
+	uint32_t uCapture = uPending & m_uCaptureLines;
+	uPending         &= ~uCapture;
+	while (uCapture) {
+		uint32_t uLine = 31 - __CLZ(uCapture);
+		uCapture      &= ~(1UL << uLine);
+
+		QAD_EXTI_Event* pEvent = m_sEvents.reserve();
+		if (pEvent) {
+			pEvent->uCycles = uCycles;
+			pEvent->uLine   = (uint8_t)uLine;
+			pEvent->uLevel  = (uint8_t)((m_pPorts[uLine]->IDR >> uLine) & 0x1);
+		}
+	}
+	m_sEvents.publish();
+
+	//Route remaining lines to their drivers
+	while (uPending) {
+		uint32_t uLine = 31 - __CLZ(uPending);
+		uPending      &= ~(1UL << uLine);
+
+		QAD_EXTI* pDriver = m_pLines[uLine];
+		if (pDriver)
+			pDriver->handler();
+	}
+}
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: External Interrupt Manager                                      */
+/*   Filename: QAD_EXTIMgr.hpp                                             */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_EXTIMGR_HPP_
+#define __QAD_EXTIMGR_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_Queue.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Forward declaration of QAD_EXTI driver class (defined in QAD_EXTI.hpp)
+class QAD_EXTI;
+
+
+//------------------
+//QAD_EXTI_LineCount
+//
+//Number of GPIO external interrupt lines (one per pin number, shared between GPIO ports)
+const uint8_t QAD_EXTI_LineCount = 16;
+
+
+//--------------
+//QAD_EXTI_LINES
+//
+//Masks of the external interrupt lines served by each of the external interrupt IRQs
+#define QAD_EXTI_LINES_0      0x0001
+#define QAD_EXTI_LINES_1      0x0002
+#define QAD_EXTI_LINES_2      0x0004
+#define QAD_EXTI_LINES_3      0x0008
+#define QAD_EXTI_LINES_4      0x0010
+#define QAD_EXTI_LINES_9_5    0x03E0
+#define QAD_EXTI_LINES_15_10  0xFC00
+
+
+//---------------------
+//QAD_EXTI_CAPTURE_SIZE
+//
+//Number of events held by the capture queue. Must be a power of two
+#define QAD_EXTI_CAPTURE_SIZE  32
+
+
+//--------------
+//QAD_EXTI_Event
+//
+//Structure used to hold an edge recorded by the capture queue
+typedef struct {
+
+	uint32_t          uCycles;      //Core clock cycle count at the start of the interrupt in which the edge was recorded (QAD_Timestamp::getCycles())
+	uint8_t           uLine;        //External interrupt line of the edge (the pin number, 0 to 15)
+	uint8_t           uLevel;       //Level of the pin when the edge was recorded (1 after a rising edge, 0 after a falling edge)
+
+} QAD_EXTI_Event;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------
+//QAD_EXTIMgr
+//
+//Static class
+//Used to route external interrupts to the QAD_EXTI driver registered for each line, and to make sure that a line is only used by one
+//driver at a time (as the same pin number on different GPIO ports shares a single line)
+//
+//The manager also owns the external interrupt IRQs, enabling each IRQ when the first of its lines is registered and disabling it when
+//the last is deregistered, so drivers sharing the EXTI9_5 and EXTI15_10 IRQs cannot disable each other's interrupts.
+//
+//The IRQ handler functions within handlers.cpp call dispatch() with the mask of the lines served by that IRQ. The pending register is
+//read once, all pending lines are cleared together, and each is then routed to its driver through the m_pLines table, with lines found
+//by count-leading-zeros bit scanning. The cost of each interrupt therefore depends only on the number of lines pending, not on the number
+//of external interrupt drivers in use, and lines sharing the EXTI9_5 and EXTI15_10 IRQs are all served in a single interrupt
+//
+//Lines in capture mode are not routed to their drivers. Instead each edge is recorded as a QAD_EXTI_Event, holding the cycle count taken
+//on entry to the interrupt, into a lock-free single-producer single-consumer queue (QAT_Queue), which is drained in batches by readEvents() from the
+//main loop. The producer is always an external interrupt IRQ, and as these all share QAD_IRQPRIORITY_EXTI they cannot preempt each other,
+//so only a single producer ever writes to the queue. When the queue is full further edges are dropped and counted
+class QAD_EXTIMgr {
+private:
+
+	//Driver registered for each line, or nullptr if the line is unused
+	static QAD_EXTI* m_pLines[QAD_EXTI_LineCount];
+
+	//GPIO port of each registered line, used to read the pin level of captured edges
+	static GPIO_TypeDef* m_pPorts[QAD_EXTI_LineCount];
+
+	//Capture Queue
+	static uint32_t          m_uCaptureLines;                   //Mask of lines in capture mode
+	static QAT_Queue<QAD_EXTI_Event, QAD_EXTI_CAPTURE_SIZE> m_sEvents;  //Queue of captured edges, only written by dispatch() (QAT_Queue defined in QAT_Queue.hpp)
+
+public:
+
+	//--------------------------------------------------------------------
+	//Delete constructors and assignment operator due to being a static class
+	QAD_EXTIMgr() = delete;
+	QAD_EXTIMgr(const QAD_EXTIMgr& other) = delete;
+	QAD_EXTIMgr& operator=(const QAD_EXTIMgr& other) = delete;
+
+
+	//------------
+	//Data Methods
+
+	//Used to retrieve the line number of a GPIO pin
+	//uPin - The pin number. A member of GPIO_pins_define as defined in stm32f1xx_hal_gpio.h
+	//Returns the line number (0 to 15)
+	static uint8_t getLine(uint16_t uPin) {
+		return (uint8_t)(31 - __CLZ(uPin));
+	}
+
+	//Used to retrieve the IRQ that serves a line
+	//uLine - The line number (0 to 15)
+	//Returns member of IRQn_Type enum, as defined in stm32f103x6.h
+	static constexpr IRQn_Type getIRQ(uint8_t uLine) {
+		return (uLine < 5) ? (IRQn_Type)(EXTI0_IRQn + uLine) : ((uLine < 10) ? EXTI9_5_IRQn : EXTI15_10_IRQn);
+	}
+
+	//Used to retrieve the mask of all lines served by the same IRQ as a line
+	//uLine - The line number (0 to 15)
+	//Returns a QAD_EXTI_LINES_x mask
+	static constexpr uint32_t getIRQLines(uint8_t uLine) {
+		return (uLine < 5) ? (1UL << uLine) : ((uLine < 10) ? QAD_EXTI_LINES_9_5 : QAD_EXTI_LINES_15_10);
+	}
+
+	//Used to retrieve the driver registered for a line
+	//uLine - The line number (0 to 15)
+	//Returns a pointer to the QAD_EXTI driver, or nullptr if the line is unused
+	static QAD_EXTI* getDriver(uint8_t uLine) {
+		return m_pLines[uLine];
+	}
+
+
+	//------------------
+	//Management Methods
+
+	static QA_Result registerLine(uint8_t uLine, QAD_EXTI* pDriver, GPIO_TypeDef* pGPIO);
+	static void deregisterLine(uint8_t uLine, QAD_EXTI* pDriver);
+
+
+	//---------------
+	//Capture Methods
+
+	static void setCapture(uint8_t uLine, QA_ActiveState eCapture);
+	static uint32_t readEvents(QAD_EXTI_Event* pEvents, uint32_t uMax);
+	static uint32_t getEventCount(void);
+	static uint32_t getDropped(void);
+	static void clearEvents(void);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	static void dispatch(uint32_t uLines);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_EXTIMGR_HPP_ */
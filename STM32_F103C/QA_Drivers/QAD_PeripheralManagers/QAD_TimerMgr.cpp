@@ -24,64 +24,38 @@
 	//------------------------------------------
 
 
-  //-------------------------
-  //-------------------------
-	//QAD_TimerMgr Constructors
+  //-----------------------
+  //-----------------------
+  //QAD_TimerMgr Data Tables
 
-//QAD_TimerMgr::QAD_TimerMgr
-//QAD_TimerMgr Constructor
+//QAD_TimerMgr::m_sTimers
+//QAD_TimerMgr Descriptor Table
 //
-//Fills out details for the system's Tiemr peripherals
-//As this is a private method in a singleton class, this method will be called the first time the class's get() method is called
-QAD_TimerMgr::QAD_TimerMgr() {
-
-  for (uint8_t i=0; i < QAD_Timer_PeriphCount; i++) {
-  	m_sTimers[i].eState   = QAD_Timer_Unused;
-  	m_sTimers[i].bEncoder = true;
-  	m_sTimers[i].bADC     = false; //NEEDS TO BE UPDATED
-  }
-
-  //Set Timer Periph ID
-  m_sTimers[QAD_Timer1].eTimer  = QAD_Timer1;
-  m_sTimers[QAD_Timer2].eTimer  = QAD_Timer2;
-  m_sTimers[QAD_Timer3].eTimer  = QAD_Timer3;
-
-	//Set clock speeds
-	m_sTimers[QAD_Timer1].uClockSpeed  = HAL_RCC_GetPCLK2Freq();
-	m_sTimers[QAD_Timer2].uClockSpeed  = HAL_RCC_GetPCLK1Freq() * 2;
-	m_sTimers[QAD_Timer3].uClockSpeed  = HAL_RCC_GetPCLK1Freq() * 2;
-
-	//Set types
-	m_sTimers[QAD_Timer1].eType  = QAD_Timer_16bit;
-	m_sTimers[QAD_Timer2].eType  = QAD_Timer_16bit;
-	m_sTimers[QAD_Timer3].eType  = QAD_Timer_16bit;
+//Definition of constexpr descriptor table declared within QAD_TimerMgr class, required for it to be indexed at runtime
+constexpr QAD_Timer_Desc QAD_TimerMgr::m_sTimers[QAD_Timer_PeriphCount];
 
-	//Set channel counts
-	m_sTimers[QAD_Timer1].uChannels  = 4;
-	m_sTimers[QAD_Timer2].uChannels  = 4;
-	m_sTimers[QAD_Timer3].uChannels  = 4;
 
-	//Set Instances
-	m_sTimers[QAD_Timer1].pInstance  = TIM1;
-	m_sTimers[QAD_Timer2].pInstance  = TIM2;
-	m_sTimers[QAD_Timer3].pInstance  = TIM3;
+//QAD_TimerMgr::m_sPairs
+//QAD_TimerMgr Pair Descriptor Table
+//
+//Definition of constexpr pair descriptor table declared within QAD_TimerMgr class, required for it to be indexed at runtime
+constexpr QAD_Timer_PairDesc QAD_TimerMgr::m_sPairs[QAD_Timer_PairCount];
 
-	//Set Update IRQs
-	m_sTimers[QAD_Timer1].eIRQ_Update  = TIM1_UP_IRQn;
-	m_sTimers[QAD_Timer2].eIRQ_Update  = TIM2_IRQn;
-	m_sTimers[QAD_Timer3].eIRQ_Update  = TIM3_IRQn;
 
-}
+//QAD_TimerMgr::m_eStates
+//QAD_TimerMgr State Table
+//
+//Stores whether each Timer peripheral is in use. Zero initialized to QAD_Timer_Unused before main() is called
+QAD_Timer_State QAD_TimerMgr::m_eStates[QAD_Timer_PeriphCount] = {QAD_Timer_Unused};
 
 
   //-------------------------------
   //-------------------------------
   //QAD_TimerMgr Management Methods
 
-//QAD_TimerMgr::imp_registerTimer
+//QAD_TimerMgr::registerTimer
 //QAD_TimerMgr Management Method
 //
-//To be called from static method registerTimer()
 //Used to register a Timer peripheral as being used by a driver
 //eTimer - The timer peripheral to be registered. A member of QAD_Timer_Periph
 //eState - The purpose the timer is to be used for. A member of QAD_Timer_State
@@ -89,94 +63,144 @@ QAD_TimerMgr::QAD_TimerMgr() {
 //         QAD_Timer_InUse_Encoder - Specifies timer as being used in rotary encoder mode
 //         QAD_Timer_InUse_PWM     - Specifies timer as being used to generate PWM signals
 //         QAD_Timer_InUse_ADC     - Specifies timer as being used to trigger ADC conversions
+//         QAD_Timer_InUse_Capture - Specifies timer as being used for input capture
+//         QAD_Timer_InUse_Chained - Specifies timer as being used as part of a chained Timer pair (normally registered by registerTimerPair())
+//         QAD_Timer_InUse_Servo   - Specifies timer as being used to sequence servo pulses
+//         QAD_Timer_InUse_GPIOBus - Specifies timer as being used to pace DMA patterns output by a GPIO bus
 //Returns QA_OK if registration is successful.
 //        QA_Fail if eState is set to QAD_Timer_Unused.
 //        QA_Error_PeriphBusy if selected Timer is already in use
-QA_Result QAD_TimerMgr::imp_registerTimer(QAD_Timer_Periph eTimer, QAD_Timer_State eState) {
-  if (m_sTimers[eTimer].eState)
+QA_Result QAD_TimerMgr::registerTimer(QAD_Timer_Periph eTimer, QAD_Timer_State eState) {
+  if (m_eStates[eTimer])
   	return QA_Error_PeriphBusy;
 
   if (!eState)
   	return QA_Fail;
 
-  m_sTimers[eTimer].eState = eState;
+  m_eStates[eTimer] = eState;
   return QA_OK;
 }
 
 
-//QAD_TimerMgr::imp_deregisterTimer
+//QAD_TimerMgr::deregisterTimer
 //QAD_TimerMgr Management Method
 //
-//To be called from static method registerTimer()
 //Used to deregister a Timer peripheral to mark it as no longer being used by a driver
 //eTimer - The Timer peripheral to be deregistered. A member of QAD_Timer_Periph
-void QAD_TimerMgr::imp_deregisterTimer(QAD_Timer_Periph eTimer) {
-  m_sTimers[eTimer].eState = QAD_Timer_Unused;
+void QAD_TimerMgr::deregisterTimer(QAD_Timer_Periph eTimer) {
+  m_eStates[eTimer] = QAD_Timer_Unused;
 }
 
 
-//QAD_TimerMgr::imp_findTimer
+//QAD_TimerMgr::findTimer
 //QAD_TimerMgr Management Method
 //
-//To be called from static method findTimer()
 //Used to find an available timer with the selected counter type (16bit or 32bit)
 //If a 16bit counter type is selected, a 32bit timer can be returned due to 32bit timers having 16bit support
+//As the STM32F103C6 has no 32bit timers, findTimerPair() is to be used to find a pair of 16bit timers that can be chained into a 32bit counter
 //eType - A member of QAD_Timer_Type to select if a 16bit or 32bit counter is required
 //Returns QAD_TimerNone if no available timer is found, or another member of QAD_Timer_Periph for the available timer that has been found
-QAD_Timer_Periph QAD_TimerMgr::imp_findTimer(QAD_Timer_Type eType) {
+QAD_Timer_Periph QAD_TimerMgr::findTimer(QAD_Timer_Type eType) {
 
 	for (uint8_t i=0; i<QAD_Timer_PeriphCount; i++) {
-		if ((eType <= m_sTimers[i].eType) && (!m_sTimers[i].eState))
+		if ((eType <= m_sTimers[i].eType) && (!m_eStates[i]))
 			return m_sTimers[i].eTimer;
 	}
 	return QAD_TimerNone;
 }
 
 
-//QAD_TimerMgr::imp_findTimerEncoder
+//QAD_TimerMgr::findTimerEncoder
 //QAD_TimerMgr Management Method
 //
-//To be called from static method findTimerEncoder()
 //Used to find an available timer with rotary encoder support
 //Returns QAD_TimerNone if no available timer is found, or another member of QAD_Timer_Periph for the available timer that has been found
-QAD_Timer_Periph QAD_TimerMgr::imp_findTimerEncoder(void) {
+QAD_Timer_Periph QAD_TimerMgr::findTimerEncoder(void) {
 
 	for (uint8_t i=0; i<QAD_Timer_PeriphCount; i++) {
-		if ((!m_sTimers[i].eState) && (m_sTimers[i].bEncoder))
+		if ((!m_eStates[i]) && (m_sTimers[i].bEncoder))
 			return m_sTimers[i].eTimer;
 	}
 	return QAD_TimerNone;
 }
 
 
-//QAD_TimerMgr::imp_findTimerADC
+//QAD_TimerMgr::findTimerADC
 //QAD_TimerMgr Management Method
 //
-//To be called from static method findTimerADC()
 //Used to find an available timer with ADC conversion triggering support
 //Returns QAD_TimerNone if no available timer is found, or another member of QAD_Timer_Periph for the available timer that has been found
-QAD_Timer_Periph QAD_TimerMgr::imp_findTimerADC(void) {
+QAD_Timer_Periph QAD_TimerMgr::findTimerADC(void) {
 
 	for (uint8_t i=0; i<QAD_Timer_PeriphCount; i++) {
-		if ((!m_sTimers[i].eState) && (m_sTimers[i].bADC))
+		if ((!m_eStates[i]) && (m_sTimers[i].bADC))
 			return m_sTimers[i].eTimer;
 	}
 	return QAD_TimerNone;
 }
 
 
+//QAD_TimerMgr::registerTimerPair
+//QAD_TimerMgr Management Method
+//
+//Used to register both Timer peripherals of a chained Timer pair as being used by a driver
+//ePair - The Timer pair to be registered. A member of QAD_Timer_Pair
+//Returns QA_OK if registration is successful.
+//        QA_Fail if ePair is not a valid Timer pair.
+//        QA_Error_PeriphBusy if either Timer of the pair is already in use
+QA_Result QAD_TimerMgr::registerTimerPair(QAD_Timer_Pair ePair) {
+	if (ePair >= QAD_TimerPairNone)
+		return QA_Fail;
+
+	if ((m_eStates[m_sPairs[ePair].eMaster]) || (m_eStates[m_sPairs[ePair].eSlave]))
+		return QA_Error_PeriphBusy;
+
+	m_eStates[m_sPairs[ePair].eMaster] = QAD_Timer_InUse_Chained;
+	m_eStates[m_sPairs[ePair].eSlave]  = QAD_Timer_InUse_Chained;
+	return QA_OK;
+}
+
+
+//QAD_TimerMgr::deregisterTimerPair
+//QAD_TimerMgr Management Method
+//
+//Used to deregister both Timer peripherals of a chained Timer pair to mark them as no longer being used by a driver
+//ePair - The Timer pair to be deregistered. A member of QAD_Timer_Pair
+void QAD_TimerMgr::deregisterTimerPair(QAD_Timer_Pair ePair) {
+	if (ePair >= QAD_TimerPairNone)
+		return;
+
+	m_eStates[m_sPairs[ePair].eMaster] = QAD_Timer_Unused;
+	m_eStates[m_sPairs[ePair].eSlave]  = QAD_Timer_Unused;
+}
+
+
+//QAD_TimerMgr::findTimerPair
+//QAD_TimerMgr Management Method
+//
+//Used to find an available pair of Timer peripherals that can be chained to form a 32bit counter
+//Returns QAD_TimerPairNone if no available pair is found, or another member of QAD_Timer_Pair for the available pair that has been found
+QAD_Timer_Pair QAD_TimerMgr::findTimerPair(void) {
+
+	for (uint8_t i=0; i<QAD_Timer_PairCount; i++) {
+		if ((!m_eStates[m_sPairs[i].eMaster]) && (!m_eStates[m_sPairs[i].eSlave]))
+			return m_sPairs[i].ePair;
+	}
+	return QAD_TimerPairNone;
+}
+
+
   //--------------------------
   //--------------------------
   //QAD_TimerMgr Clock Methods
 
 
-//QAD_TimerMgr::imp_enableClock
+//QAD_TimerMgr::enableClock
 //QAD_TimerMgr Clock Method
 //
-//To be called by enableClock()
 //Used to enable the clock for a specific Timer peripheral
 //eTimer - the Timer peripheral to enable the clock for
-void QAD_TimerMgr::imp_enableClock(QAD_Timer_Periph eTimer) {
+void QAD_TimerMgr::enableClock(QAD_Timer_Periph eTimer) {
   switch (eTimer) {
     case (QAD_Timer1):
     	__HAL_RCC_TIM1_CLK_ENABLE();
@@ -199,13 +223,12 @@ void QAD_TimerMgr::imp_enableClock(QAD_Timer_Periph eTimer) {
 }
 
 
-//QAD_TimerMgr::imp_disableClock
+//QAD_TimerMgr::disableClock
 //QAD_TimerMgr Clock Method
 //
-//To be called by disableClock()
 //Used to disable the clock for a specific Timer peripheral
 //eTimer - The timer peripheral to disable the clock for
-void QAD_TimerMgr::imp_disableClock(QAD_Timer_Periph eTimer) {
+void QAD_TimerMgr::disableClock(QAD_Timer_Periph eTimer) {
   switch (eTimer) {
     case (QAD_Timer1):
     	__HAL_RCC_TIM1_CLK_DISABLE();
@@ -227,15 +250,14 @@ void QAD_TimerMgr::imp_disableClock(QAD_Timer_Periph eTimer) {
   //QAD_TimerMgr Status Methods
 
 
-//QAD_TimerMgr::imp_getTimersActive
+//QAD_TimerMgr::getTimersActive
 //QAD_TimerMgr Status Method
 //
-//To be called by getTimersActive()
 //Returns the number of Timer peripherals that are currently in-use (registered/active)
-uint8_t QAD_TimerMgr::imp_getTimersActive(void) {
+uint8_t QAD_TimerMgr::getTimersActive(void) {
   uint8_t uCount = 0;
   for (uint8_t i=0; i<QAD_Timer_PeriphCount; i++) {
-  	if (m_sTimers[i].eState)
+  	if (m_eStates[i])
   		uCount++;
   }
   return uCount;
@@ -245,12 +267,11 @@ uint8_t QAD_TimerMgr::imp_getTimersActive(void) {
 //QAD_TimerMgr::getTimersInactive
 //QAD_TimerMgr Status Method
 //
-//To be called by getTimersInactive()
 //Returns the number of Timer peripherals that are currently not being used (deregistered/inactive)
-uint8_t QAD_TimerMgr::imp_getTimersInactive(void) {
+uint8_t QAD_TimerMgr::getTimersInactive(void) {
   uint8_t uCount = 0;
   for (uint8_t i=0; i<QAD_Timer_PeriphCount; i++) {
-  	if (!m_sTimers[i].eState)
+  	if (!m_eStates[i])
   		uCount++;
   }
   return uCount;
@@ -22,6 +22,8 @@
 //Includes
 #include "setup.hpp"
 
+#include "QAD_DMAMgr.hpp"
+
 
 	//------------------------------------------
 	//------------------------------------------
@@ -56,10 +58,38 @@ enum QAD_Timer_State : uint8_t {
 	QAD_Timer_InUse_IRQ,
 	QAD_Timer_InUse_Encoder,
 	QAD_Timer_InUse_PWM,
-	QAD_Timer_InUse_ADC
+	QAD_Timer_InUse_ADC,
+	QAD_Timer_InUse_Capture,
+	QAD_Timer_InUse_Chained,
+	QAD_Timer_InUse_Servo,
+	QAD_Timer_InUse_GPIOBus
 };
 
 
+//--------------
+//QAD_Timer_Pair
+//
+//Used to select a pair of Timer peripherals that can be chained to form a 32bit counter, and index into pair array in Timer Manager
+//The first timer of each pair is the master, which provides the low 16bits of the count, and the second is the slave, which counts the
+//update events of the master to provide the high 16bits
+enum QAD_Timer_Pair : uint8_t {
+	QAD_TimerPair_2_3 = 0,
+	QAD_TimerPair_3_2,
+	QAD_TimerPair_1_2,
+	QAD_TimerPair_1_3,
+	QAD_TimerPair_2_1,
+	QAD_TimerPair_3_1,
+	QAD_TimerPairNone
+};
+
+
+//-------------------
+//QAD_Timer_PairCount
+//
+//Timer Pair Count
+const uint8_t QAD_Timer_PairCount = QAD_TimerPairNone;
+
+
 //--------------
 //QAD_Timer_Type
 //
@@ -67,33 +97,96 @@ enum QAD_Timer_State : uint8_t {
 enum QAD_Timer_Type : uint8_t {QAD_Timer_16bit = 0, QAD_Timer_32bit};
 
 
+//--------------------
+//QAD_Timer_ADCTrigger
+//
+//Used to store which timer event is connected to the ADC regular group external trigger for a particular Timer peripheral
+enum QAD_Timer_ADCTrigger : uint8_t {
+	QAD_Timer_ADCTrigger_None = 0,  //Timer is unable to trigger ADC conversions
+	QAD_Timer_ADCTrigger_TRGO,      //ADC conversions are triggered by the timer's trigger output (TRGO), set to the update event
+	QAD_Timer_ADCTrigger_CC1,       //ADC conversions are triggered by a capture/compare channel 1 event
+	QAD_Timer_ADCTrigger_CC2        //ADC conversions are triggered by a capture/compare channel 2 event
+};
+
+
 	//------------------------------------------
 	//------------------------------------------
 	//------------------------------------------
 
 
 //--------------
-//QAD_Timer_Data
+//QAD_Timer_Desc
 //
-//Structure used in array within QAD_TimerMgr class to hold information for Timer peripherals
+//Structure used in constant table within QAD_TimerMgr class to hold the fixed hardware details of Timer peripherals
+//All members are known at compile time, so lookups with a constant Timer peripheral are folded to constants by the compiler
 typedef struct {
 
 	QAD_Timer_Periph  eTimer;        //Used to store which Timer peripheral is represented by the structure, used for manager methods that find unused Timers
 
-	QAD_Timer_State   eState;        //Stores whether the Timer peripheral is currently in use, and what purpose it is being used for
-
-	uint32_t          uClockSpeed;   //Stores the input clock speed for the Timer peripheral
+	uint32_t          uClockSpeed;   //Stores the input clock speed for the Timer peripheral (defined in setup.hpp)
 	QAD_Timer_Type    eType;         //Stores whether the particular timer has a 16bit or 32bit counter
 	uint8_t           uChannels;     //Stores the number of channels supported by the particular Timer peripheral
+	bool              bAdvanced;     //Stores whether the Timer peripheral is an advanced-control timer, with complementary outputs, dead-time
+	                                 //generation and a break input
 
 	bool              bEncoder;      //Stores whether the Timer peripheral has support for rotary encoder mode
 	bool              bADC;          //Stores whether the Timer peripheral has support for triggering ADC conversions
+	QAD_Timer_ADCTrigger eADCTrigger; //Stores which timer event triggers ADC conversions. Member of QAD_Timer_ADCTrigger
+	uint32_t          uADCExtSel;    //Stores the ADC regular group external trigger selection for the Timer peripheral (defined in stm32f1xx_hal_adc_ex.h)
 
-	TIM_TypeDef*      pInstance;     //Stores the TIM_TypeDef for the Timer peripheral (defined in stm32f103x6.h)
+	uint32_t          uBase;         //Stores the base address of the Timer peripheral (TIMx_BASE defined in stm32f103x6.h)
+	                                 //Stored as an address rather than a TIM_TypeDef pointer, as a pointer cast is not permitted in a constant expression
 
 	IRQn_Type         eIRQ_Update;   //Stores the IRQ Handler enum for the Timer peripheral (defined in stm32f103x6.h)
+	IRQn_Type         eIRQ_CC;       //Stores the capture/compare IRQ Handler enum for the Timer peripheral
+	                                 //This is the same as eIRQ_Update for general purpose timers, which share a single IRQ
+
+	QAD_DMA_Channel   eDMA_CC[4];    //Stores the DMA channel mapped to each capture/compare channel's DMA request
+	                                 //QAD_DMA_ChannelNone if the capture/compare channel has no DMA request. Member of QAD_DMA_Channel as defined in QAD_DMAMgr.hpp
+	QAD_DMA_Channel   eDMA_Update;   //Stores the DMA channel mapped to the Timer peripheral's update DMA request
+
+} QAD_Timer_Desc;
+
+
+//------------------
+//QAD_Timer_PairDesc
+//
+//Structure used in constant table within QAD_TimerMgr class to hold the fixed details of chainable Timer peripheral pairs
+typedef struct {
+
+	QAD_Timer_Pair    ePair;         //Used to store which Timer pair is represented by the structure, used for manager methods that find unused pairs
 
-} QAD_Timer_Data;
+	QAD_Timer_Periph  eMaster;       //Stores the master Timer peripheral, whose update event is output as its trigger output (TRGO)
+	QAD_Timer_Periph  eSlave;        //Stores the slave Timer peripheral, which is clocked by the master's trigger output
+
+	uint32_t          uITR;          //Stores the slave's internal trigger selection that is connected to the master's trigger output
+	                                 //TIM_TS_ITRx define, as defined in stm32f1xx_hal_tim.h
+
+} QAD_Timer_PairDesc;
+
+
+//--------------------
+//QAD_TIMER_FREQSEARCH
+//
+//Maximum number of prescalers examined by QAD_TimerMgr::calcFrequency(), which bounds its run time when called at runtime
+#define QAD_TIMER_FREQSEARCH   256
+
+
+//--------------------
+//QAD_Timer_FreqConfig
+//
+//Structure returned by QAD_TimerMgr::calcFrequency() to hold the prescaler and period found for a target frequency
+typedef struct {
+
+	bool              bValid;        //Set to true if a valid prescaler and period have been found
+
+	uint32_t          uPrescaler;    //Value to be used for the prescaler (the timer clock is divided by uPrescaler+1)
+	uint32_t          uPeriod;       //Value to be used for the counter period (each period is uPeriod+1 timer ticks)
+
+	uint32_t          uFrequency;    //Achieved frequency in Hz, rounded to the nearest Hz
+	int32_t           iError_ppm;    //Error of the achieved frequency from the target frequency, in parts per million
+
+} QAD_Timer_FreqConfig;
 
 
 	//------------------------------------------
@@ -104,37 +197,57 @@ typedef struct {
 //------------
 //QAD_TimerMgr
 //
-//Singleton class
+//Static class
 //Used to allow management of Timer peripherals in order to make sure that a driver is prevented from accessing any
 //Timer peripherals that are already being used by another driver
+//
+//The fixed hardware details of each Timer peripheral are held in the constexpr m_sTimers table, while the only mutable data is the
+//small m_eStates array recording which Timer peripherals are in use. As neither requires construction, no function-local singleton
+//guard is needed, and data methods are constexpr so they can be used in static_assert() to check peripheral choices at compile time
 class QAD_TimerMgr {
 private:
 
-	//Timer Data
-	QAD_Timer_Data  m_sTimers[QAD_Timer_PeriphCount];
+	//Timer Descriptors
+	static constexpr QAD_Timer_Desc m_sTimers[QAD_Timer_PeriphCount] = {
 
-	//------------
-	//Constructors
-	QAD_TimerMgr();
+		//eTimer      uClockSpeed         eType            uChannels bAdvanced bEncoder bADC  eADCTrigger                 uADCExtSel
+		{QAD_Timer1,  QAD_CLOCK_TIMPCLK2, QAD_Timer_16bit, 4,        true,     true,    true, QAD_Timer_ADCTrigger_CC1,   ADC_EXTERNALTRIGCONV_T1_CC1,
+		//uBase       eIRQ_Update    eIRQ_CC        eDMA_CC                                                                        eDMA_Update
+		 TIM1_BASE,   TIM1_UP_IRQn,  TIM1_CC_IRQn,  {QAD_DMA1_Channel2, QAD_DMA1_Channel3, QAD_DMA1_Channel6, QAD_DMA1_Channel4}, QAD_DMA1_Channel5},
+
+		{QAD_Timer2,  QAD_CLOCK_TIMPCLK1, QAD_Timer_16bit, 4,        false,    true,    true, QAD_Timer_ADCTrigger_CC2,   ADC_EXTERNALTRIGCONV_T2_CC2,
+		 TIM2_BASE,   TIM2_IRQn,     TIM2_IRQn,     {QAD_DMA1_Channel5, QAD_DMA1_Channel7, QAD_DMA1_Channel1, QAD_DMA1_Channel7}, QAD_DMA1_Channel2},
+
+		{QAD_Timer3,  QAD_CLOCK_TIMPCLK1, QAD_Timer_16bit, 4,        false,    true,    true, QAD_Timer_ADCTrigger_TRGO,  ADC_EXTERNALTRIGCONV_T3_TRGO,
+		 TIM3_BASE,   TIM3_IRQn,     TIM3_IRQn,     {QAD_DMA1_Channel6, QAD_DMA_ChannelNone, QAD_DMA1_Channel2, QAD_DMA1_Channel3}, QAD_DMA1_Channel3}
+		                                            //TIM3 CH2 has no DMA request
+	};
+
+	//Timer Pair Descriptors
+	//Pairs not using Timer 1 are listed first, so that findTimerPair() leaves the advanced-control timer available where possible
+	static constexpr QAD_Timer_PairDesc m_sPairs[QAD_Timer_PairCount] = {
+
+		//ePair              eMaster     eSlave      uITR
+		{QAD_TimerPair_2_3,  QAD_Timer2, QAD_Timer3, TIM_TS_ITR1},
+		{QAD_TimerPair_3_2,  QAD_Timer3, QAD_Timer2, TIM_TS_ITR2},
+		{QAD_TimerPair_1_2,  QAD_Timer1, QAD_Timer2, TIM_TS_ITR0},
+		{QAD_TimerPair_1_3,  QAD_Timer1, QAD_Timer3, TIM_TS_ITR0},
+		{QAD_TimerPair_2_1,  QAD_Timer2, QAD_Timer1, TIM_TS_ITR1},
+		{QAD_TimerPair_3_1,  QAD_Timer3, QAD_Timer1, TIM_TS_ITR2}
+	};
+
+	//Timer States
+	static QAD_Timer_State m_eStates[QAD_Timer_PeriphCount];
 
 public:
 
-	//------------------------------------------------------------------------------
-	//Delete copy constructor and assignment operator due to being a singleton class
+	//--------------------------------------------------------------------
+	//Delete constructors and assignment operator due to being a static class
+	QAD_TimerMgr() = delete;
 	QAD_TimerMgr(const QAD_TimerMgr& other) = delete;
 	QAD_TimerMgr& operator=(const QAD_TimerMgr& other) = delete;
 
 
-	//-----------------
-	//Singleton Methods
-	//
-	//Used to retrieve a reference to the singleton class
-	static QAD_TimerMgr& get(void) {
-		static QAD_TimerMgr instance;
-		return instance;
-	}
-
-
 	//------------
   //Data Methods
 
@@ -142,156 +255,270 @@ public:
 	//eTimer - The Timer peripheral to retrieve the state for. Member of QAD_Timer_Periph
 	//Returns member of QAD_TimerState enum
 	static QAD_Timer_State getState(QAD_Timer_Periph eTimer) {
-		return get().m_sTimers[eTimer].eState;
+		return m_eStates[eTimer];
 	}
 
 	//Used to retrieve the input clock speed of a Timer peripheral
 	//eTimer - The Timer peripheral to retrieve the state for. Member of QAD_Timer_Periph
 	//Returns the frequency in Hz of the Timer's input clock
-	static uint32_t getClockSpeed(QAD_Timer_Periph eTimer) {
-		return get().m_sTimers[eTimer].uClockSpeed;
+	static constexpr uint32_t getClockSpeed(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].uClockSpeed;
 	}
 
 	//Used to retrieve the counter type of a Timer peripheral
 	//eTimer - The Timer peripheral to retrieve the state for. Member of QAD_Timer_Periph
 	//Returns a member of QAD_Timer_Type (QAD_Timer_16bit or QAD_Timer_32bit)
-	static QAD_Timer_Type getType(QAD_Timer_Periph eTimer) {
-		return get().m_sTimers[eTimer].eType;
+	static constexpr QAD_Timer_Type getType(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].eType;
 	}
 
 	//Used to retrieve the number of channels supported by a Timer peripheral
 	//eTimer - The Timer peripheral to retrieve the state for. Member of QAD_Timer_Periph
 	//Returns the number of channels supported by the Timer peripheral
-	static uint8_t getChannels(QAD_Timer_Periph eTimer) {
-		return get().m_sTimers[eTimer].uChannels;
+	static constexpr uint8_t getChannels(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].uChannels;
+	}
+
+	//Used to retrieve whether a particular Timer peripheral is an advanced-control timer
+	//eTimer - The Timer peripheral to retrieve the advanced-control support for. Member of QAD_Timer_Periph
+	//Returns true if the timer has complementary outputs, dead-time generation and a break input, or false if not
+	static constexpr bool getAdvanced(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].bAdvanced;
 	}
 
 	//Used to retrieve whether a particular Timer peripheral has rotary encoder mode support
 	//eTimer - The Timer peripheral to retrieve the rotary encoder mode support for. Member of QAD_Timer_Periph
 	//Returns true if the timer has rotary encoder mode support, or false if not supported
-	static bool getEncoder(QAD_Timer_Periph eTimer) {
-		return get().m_sTimers[eTimer].bEncoder;
+	static constexpr bool getEncoder(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].bEncoder;
 	}
 
 	//Used to retrieve whether a particular Tiemr peripheral has triggering support for ADC conversions
 	//eTimer - The Timer peripheral to retrieve the ADC support for. Member of QAD_Timer_Periph
 	//Returns true if the timer has ADC conversion triggering support, or false if not supported
-	static bool getADC(QAD_Timer_Periph eTimer) {
-		return get().m_sTimers[eTimer].bADC;
+	static constexpr bool getADC(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].bADC;
+	}
+
+	//Used to retrieve which timer event is used to trigger ADC conversions for a particular Timer peripheral
+	//eTimer - The Timer peripheral to retrieve the ADC trigger for. Member of QAD_Timer_Periph
+	//Returns member of QAD_Timer_ADCTrigger enum
+	static constexpr QAD_Timer_ADCTrigger getADCTrigger(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].eADCTrigger;
+	}
+
+	//Used to retrieve the ADC regular group external trigger selection for a particular Timer peripheral
+	//eTimer - The Timer peripheral to retrieve the ADC trigger selection for. Member of QAD_Timer_Periph
+	//Returns ADC_EXTERNALTRIGCONV define, as defined in stm32f1xx_hal_adc_ex.h
+	static constexpr uint32_t getADCExtSel(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].uADCExtSel;
+	}
+
+	//Used to retrieve the base address of a Timer peripheral
+	//eTimer - The Timer peripheral to retrieve the base address for. Member of QAD_Timer_Periph
+	//Returns TIMx_BASE, as defined in stm32f103x6.h
+	static constexpr uint32_t getBase(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].uBase;
 	}
 
 	//Used to retrieve an instance for a Timer peripheral
 	//eTimer - The Timer peripheral to retrieve the instance for. Member of QAD_Timer_Periph
 	//Returns TIM_TypeDef, as defined in stm32f103x6.h
 	static TIM_TypeDef* getInstance(QAD_Timer_Periph eTimer) {
-		return get().m_sTimers[eTimer].pInstance;
+		return reinterpret_cast<TIM_TypeDef*>(m_sTimers[eTimer].uBase);
 	}
 
 	//Used to retrieve an Update IRQ enum for a Timer peripheral
 	//eTimer - The Timer peripheral to retrieve the IRQ enum for. Member of QAD_Timer_Periph
 	//Returns member of IRQn_Type enum, as defined in stm32f103x6.h
-	static IRQn_Type getUpdateIRQ(QAD_Timer_Periph eTimer) {
-		return get().m_sTimers[eTimer].eIRQ_Update;
+	static constexpr IRQn_Type getUpdateIRQ(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].eIRQ_Update;
 	}
 
-
-	//------------------
-	//Management Methods
-
-	//Used to register a Timer peripheral as being used by a driver
-	//eTimer - The Timer peripheral to be registered. Member of QAD_Timer_Periph
-	//Returns QA_OK if registration is successful, or returns QA_Error_PeriphBusy if the selected Timer is already in use
-	static QA_Result registerTimer(QAD_Timer_Periph eTimer, QAD_Timer_State eState) {
-		return get().imp_registerTimer(eTimer, eState);
+	//Used to retrieve a Capture/Compare IRQ enum for a Timer peripheral
+	//eTimer - The Timer peripheral to retrieve the IRQ enum for. Member of QAD_Timer_Periph
+	//Returns member of IRQn_Type enum, as defined in stm32f103x6.h
+	static constexpr IRQn_Type getCCIRQ(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].eIRQ_CC;
 	}
 
-	//Used to deregister a Timer peripheral to mark it as no longer being used by a driver
-	//eTimer - The Timer peripheral to be registered. Member of QAD_Timer_Periph
-	static void deregisterTimer(QAD_Timer_Periph eTimer) {
-		get().imp_deregisterTimer(eTimer);
+	//Used to retrieve the DMA channel mapped to a capture/compare channel of a Timer peripheral
+	//eTimer   - The Timer peripheral to retrieve the DMA channel for. Member of QAD_Timer_Periph
+	//uChannel - The capture/compare channel index (0 to 3 for channels 1 to 4)
+	//Returns member of QAD_DMA_Channel enum, or QAD_DMA_ChannelNone if the capture/compare channel has no DMA request
+	static constexpr QAD_DMA_Channel getDMAChannelCC(QAD_Timer_Periph eTimer, uint8_t uChannel) {
+		return (uChannel < 4) ? m_sTimers[eTimer].eDMA_CC[uChannel] : QAD_DMA_ChannelNone;
 	}
 
-	//Used to find an available timer with the selected counter type (16bit or 32bit)
-	//If a 16bit counter type is selected, a 32bit timer can be returned due to 32bit timers having 16bit support
-	//eType - A member of QAD_Timer_Type to select if a 16bit or 32bit counter is required
-	//Returns QAD_TimerNone if no available timer is found, or another member of QAD_Timer_Periph for the available timer that has been found
-	static QAD_Timer_Periph findTimer(QAD_Timer_Type eType) {
-		return get().imp_findTimer(eType);
+	//Used to retrieve the DMA channel mapped to the update DMA request of a Timer peripheral
+	//eTimer - The Timer peripheral to retrieve the DMA channel for. Member of QAD_Timer_Periph
+	//Returns member of QAD_DMA_Channel enum
+	static constexpr QAD_DMA_Channel getDMAChannelUpdate(QAD_Timer_Periph eTimer) {
+		return m_sTimers[eTimer].eDMA_Update;
 	}
 
-	//Used to find an available timer that has rotary encoder support
-	//Returns QAD_TimerNone if no available timer is found, or another member of QAD_Timer_Periph for the available timer that has been found
-	static QAD_Timer_Periph findTimerEncoder(void) {
-		return get().imp_findTimerEncoder();
-	}
 
-	//Used to find an available timer that has ADC triggering support
-	//Returns QAD_TimerNone if no available timer is found, or another member of QAD_Timer_Periph for the available timer that has been found
-	static QAD_Timer_Periph findTimerADC(void) {
-		return get().imp_findTimerADC();
+	//Used to retrieve the master Timer peripheral of a Timer pair
+	//ePair - The Timer pair to retrieve the master for. Member of QAD_Timer_Pair
+	//Returns member of QAD_Timer_Periph enum
+	static constexpr QAD_Timer_Periph getPairMaster(QAD_Timer_Pair ePair) {
+		return m_sPairs[ePair].eMaster;
 	}
 
-
-	//-------------
-	//Clock Methods
-
-	//Used to enable the clock for a specific Timer peripheral
-	//eTimer - The Timer peripheral to enable the clock for
-	static void enableClock(QAD_Timer_Periph eTimer) {
-		get().imp_enableClock(eTimer);
+	//Used to retrieve the slave Timer peripheral of a Timer pair
+	//ePair - The Timer pair to retrieve the slave for. Member of QAD_Timer_Pair
+	//Returns member of QAD_Timer_Periph enum
+	static constexpr QAD_Timer_Periph getPairSlave(QAD_Timer_Pair ePair) {
+		return m_sPairs[ePair].eSlave;
 	}
 
-	//Used to disable the clock for a specific Timer peripheral
-	//eTimer - The Timer peripheral to disable the clock for
-	static void disableClock(QAD_Timer_Periph eTimer) {
-		get().imp_disableClock(eTimer);
+	//Used to retrieve the slave's internal trigger selection for a Timer pair
+	//ePair - The Timer pair to retrieve the internal trigger selection for. Member of QAD_Timer_Pair
+	//Returns TIM_TS_ITRx define, as defined in stm32f1xx_hal_tim.h
+	static constexpr uint32_t getPairITR(QAD_Timer_Pair ePair) {
+		return m_sPairs[ePair].uITR;
 	}
 
 
-	//--------------
-	//Status Methods
-
-	//Returns the number of Timer peripherals that are currently in-use (registered/active)
-	static uint8_t getTimersActive(void) {
-		return get().imp_getTimersActive();
+	//-----------------
+	//Frequency Methods
+
+	//Used to find the prescaler and period for a Timer peripheral that produce a frequency closest to a target frequency
+	//Prescalers are searched in ascending order from the lowest prescaler that allows the period to fit within the counter, so for pairs
+	//with equal error the one with the longest period (highest resolution) is chosen. As the total number of timer clock ticks per
+	//period is uClock/uFrequency, the error can be no lower than the distance from uClock to the nearest multiple of uFrequency, and the
+	//search ends as soon as a pair with this error is found (an exact match for most round frequencies). Otherwise the search ends after
+	//QAD_TIMER_FREQSEARCH prescalers, so the run time is bounded when called at runtime, such as from the setFrequency() methods of drivers
+	//The search itself uses only 32bit divides, with a single 64bit divide being used to find the error in parts per million
+	//As this method is constexpr, it is evaluated by the compiler when used with constant parameters in a constant expression
+	//eTimer      - The Timer peripheral the prescaler and period are to be used for. Member of QAD_Timer_Periph
+	//uFrequency  - The target frequency in Hz
+	//uResolution - The minimum number of timer ticks per period (such as the required PWM resolution). Values less than 2 are treated as 2
+	//Returns a QAD_Timer_FreqConfig structure, with bValid set to false if the target frequency cannot be produced
+	static constexpr QAD_Timer_FreqConfig calcFrequency(QAD_Timer_Periph eTimer, uint32_t uFrequency, uint32_t uResolution) {
+		QAD_Timer_FreqConfig sConfig = {false, 0, 0, 0, 0};
+
+		uint32_t uClock     = getClockSpeed(eTimer);
+		uint64_t uMaxPeriod = (getType(eTimer) == QAD_Timer_32bit) ? 0x100000000ULL : 0x10000ULL;
+		uint32_t uMinPeriod = (uResolution > 2) ? uResolution : 2;
+
+		if ((!uFrequency) || (uFrequency > uClock) || (uMinPeriod > uMaxPeriod))
+			return sConfig;
+
+		//Find the lowest possible error, being the distance from uClock to the nearest multiple of uFrequency
+		uint32_t uTicks  = uClock / uFrequency;
+		uint32_t uRem    = uClock - (uTicks * uFrequency);
+		uint32_t uMinErr = (uRem < (uFrequency - uRem)) ? uRem : (uFrequency - uRem);
+
+		//Start from the lowest prescaler that allows the period to fit within the counter, and limit the number of prescalers searched
+		uint32_t uStart = (uMaxPeriod > uTicks) ? 1 : (uTicks >> 16);
+		uint32_t uEnd   = uStart + (QAD_TIMER_FREQSEARCH - 1);
+		if (uEnd > 0x10000)
+			uEnd = 0x10000;
+
+		uint64_t uBestErr = 0;  //Error of best pair is uBestErr/uBestDiv Hz, stored as a fraction to avoid division
+		uint64_t uBestDiv = 1;
+
+		for (uint32_t uPsc=uStart; uPsc<=uEnd; uPsc++) {
+
+			//Floor of ideal period. Since (a/b)/c == a/(b*c) for integer division, no 64bit division is required
+			uint32_t uFloor = (uClock / uPsc) / uFrequency;
+			if ((uFloor + 1) < uMinPeriod)
+				break;
+
+			//Check the period either side of the ideal period
+			for (uint32_t uPer=uFloor; uPer<=(uFloor+1); uPer++) {
+				if ((uPer < uMinPeriod) || (uPer > uMaxPeriod))
+					continue;
+
+				uint64_t uDiv = (uint64_t)uPsc * uPer;
+				uint64_t uOut = (uint64_t)uFrequency * uDiv;
+				uint64_t uErr = (uOut > uClock) ? (uOut - uClock) : (uClock - uOut);
+
+				if ((!sConfig.bValid) || ((uErr * uBestDiv) < (uBestErr * uDiv))) {
+					sConfig.bValid     = true;
+					sConfig.uPrescaler = uPsc - 1;
+					sConfig.uPeriod    = uPer - 1;
+					uBestErr           = uErr;
+					uBestDiv           = uDiv;
+				}
+			}
+
+			//Stop searching once the error can no longer be improved
+			if ((sConfig.bValid) && (uBestErr <= uMinErr))
+				break;
+		}
+
+		//Calculate achieved frequency and error
+		if (sConfig.bValid) {
+			sConfig.uFrequency = getFrequency(eTimer, sConfig.uPrescaler, sConfig.uPeriod);
+			sConfig.iError_ppm = (int32_t)((((int64_t)uClock - ((int64_t)uFrequency * (int64_t)uBestDiv)) * 1000000) /
+					                           ((int64_t)uFrequency * (int64_t)uBestDiv));
+		}
+		return sConfig;
 	}
 
-	//Returns the number of Timer peripherals that are currently not being used (deregistered/active)
-	static uint8_t getTimersInactive(void) {
-		return get().imp_getTimersInactive();
+	//Used to calculate the frequency in Hz produced by a prescaler and period for a Timer peripheral, rounded to the nearest Hz
+	//Since (a/b)/c == a/(b*c) for integer division, twice the frequency is found with two 32bit divides and then rounded
+	//eTimer     - The Timer peripheral. Member of QAD_Timer_Periph
+	//uPrescaler - The prescaler value (the timer clock is divided by uPrescaler+1)
+	//uPeriod    - The counter period value (each period is uPeriod+1 timer ticks)
+	static constexpr uint32_t getFrequency(QAD_Timer_Periph eTimer, uint32_t uPrescaler, uint32_t uPeriod) {
+		return (uPeriod == 0xFFFFFFFF) ? 0 : (((((2 * getClockSpeed(eTimer)) / (uPrescaler + 1)) / (uPeriod + 1)) + 1) / 2);
 	}
 
 
-private:
-
 	//NOTE: See QAD_TimerMgr.cpp for details of the following methods
 
 	//------------------
 	//Management Methods
 
-  QA_Result imp_registerTimer(QAD_Timer_Periph eTimer, QAD_Timer_State eState);
-  void imp_deregisterTimer(QAD_Timer_Periph eTimer);
+	static QA_Result registerTimer(QAD_Timer_Periph eTimer, QAD_Timer_State eState);
+	static void deregisterTimer(QAD_Timer_Periph eTimer);
+
+	static QAD_Timer_Periph findTimer(QAD_Timer_Type eType);
+	static QAD_Timer_Periph findTimerEncoder(void);
+	static QAD_Timer_Periph findTimerADC(void);
 
-  QAD_Timer_Periph imp_findTimer(QAD_Timer_Type eType);
-  QAD_Timer_Periph imp_findTimerEncoder(void);
-  QAD_Timer_Periph imp_findTimerADC(void);
+	static QA_Result registerTimerPair(QAD_Timer_Pair ePair);
+	static void deregisterTimerPair(QAD_Timer_Pair ePair);
 
+	static QAD_Timer_Pair findTimerPair(void);
 
-  //-------------
-  //Clock Methods
 
-  void imp_enableClock(QAD_Timer_Periph eTimer);
-  void imp_disableClock(QAD_Timer_Periph eTimer);
+	//-------------
+	//Clock Methods
+
+	static void enableClock(QAD_Timer_Periph eTimer);
+	static void disableClock(QAD_Timer_Periph eTimer);
 
 
-  //--------------
-  //Status Methods
+	//--------------
+	//Status Methods
 
-  uint8_t imp_getTimersActive(void);
-  uint8_t imp_getTimersInactive(void);
+	static uint8_t getTimersActive(void);
+	static uint8_t getTimersInactive(void);
 
 };
 
 
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Compile time checks of Timer descriptor table
+static_assert(QAD_TimerMgr::getBase(QAD_Timer1) == TIM1_BASE, "QAD_TimerMgr table entry for QAD_Timer1 is out of order");
+static_assert(QAD_TimerMgr::getBase(QAD_Timer2) == TIM2_BASE, "QAD_TimerMgr table entry for QAD_Timer2 is out of order");
+static_assert(QAD_TimerMgr::getBase(QAD_Timer3) == TIM3_BASE, "QAD_TimerMgr table entry for QAD_Timer3 is out of order");
+static_assert(QAD_TimerMgr::getChannels(QAD_Timer1) <= 4, "QAD_TimerMgr supports a maximum of 4 channels per Timer");
+static_assert(QAD_TimerMgr::getChannels(QAD_Timer2) <= 4, "QAD_TimerMgr supports a maximum of 4 channels per Timer");
+static_assert(QAD_TimerMgr::getChannels(QAD_Timer3) <= 4, "QAD_TimerMgr supports a maximum of 4 channels per Timer");
+static_assert(QAD_TimerMgr::getPairMaster(QAD_TimerPair_2_3) == QAD_Timer2, "QAD_TimerMgr pair table entry for QAD_TimerPair_2_3 is out of order");
+static_assert(QAD_TimerMgr::getPairMaster(QAD_TimerPair_3_1) == QAD_Timer3, "QAD_TimerMgr pair table entry for QAD_TimerPair_3_1 is out of order");
+static_assert(QAD_TimerMgr::getPairSlave(QAD_TimerPair_3_1) == QAD_Timer1, "QAD_TimerMgr pair table entry for QAD_TimerPair_3_1 is out of order");
+static_assert(QAD_TimerMgr::calcFrequency(QAD_Timer2, 1000, 1000).iError_ppm == 0, "QAD_TimerMgr::calcFrequency() failed to find exact 1kHz configuration");
+
+
 //Prevent Recursive Inclusion
 #endif /* __QAD_TIMERMGR_HPP_ */
@@ -24,84 +24,69 @@
 	//------------------------------------------
 
 
-	//------------
-	//------------
-	//Constructors
+  //-----------------------
+	//-----------------------
+	//QAD_UARTMgr Data Tables
 
-//QAD_UARTMgr::QAD_UARTMgr
-//QAD_UARTMgr Constructor
+//QAD_UARTMgr::m_sUARTs
+//QAD_UARTMgr Descriptor Table
 //
-//Fills out details for the system's UART peripherals
-//As this is a private method in a singleton class, this method will be called the first time the class's get() method is called.
-QAD_UARTMgr::QAD_UARTMgr() {
+//Definition of constexpr descriptor table declared within QAD_UARTMgr class, required for it to be indexed at runtime
+constexpr QAD_UART_Desc QAD_UARTMgr::m_sUARTs[QAD_UART_PeriphCount];
 
-	for (uint8_t i=0; i<QAD_UART_PeriphCount; i++) {
-		m_sUARTs[i].eState = QAD_UART_Unused;
-	}
 
-	//Set UART Periph ID
-	m_sUARTs[QAD_UART1].eUART = QAD_UART1;
-	m_sUARTs[QAD_UART2].eUART = QAD_UART2;
-
-	//Set Instances
-	m_sUARTs[QAD_UART1].pInstance = USART1;
-	m_sUARTs[QAD_UART2].pInstance = USART2;
-
-	//Set IRQs
-	m_sUARTs[QAD_UART1].eIRQ = USART1_IRQn;
-	m_sUARTs[QAD_UART2].eIRQ = USART2_IRQn;
-
-}
+//QAD_UARTMgr::m_eStates
+//QAD_UARTMgr State Table
+//
+//Stores whether each UART peripheral is in use. Zero initialized to QAD_UART_Unused before main() is called
+QAD_UART_State QAD_UARTMgr::m_eStates[QAD_UART_PeriphCount] = {QAD_UART_Unused};
 
 
-  //--------------------------------------
-	//--------------------------------------
-	//QAD_UARTMgr Private Management Methods
+  //------------------------------
+	//------------------------------
+	//QAD_UARTMgr Management Methods
 
-//QAD_UARTMgr::imp_registerUART
-//QAD_UARTMgr Private Management Method
+//QAD_UARTMgr::registerUART
+//QAD_UARTMgr Management Method
 //
-//To be called from static method registerUART()
 //Used to register a UART peripheral as being used by a driver
 //eUART - the UART peripheral to be registered. A member of QAD_UART_Periph
 //Returns QA_OK if registration is successful, or returns QA_Error_PeriphBusy if the selected UART is already in use
-QA_Result QAD_UARTMgr::imp_registerUART(QAD_UART_Periph eUART) {
+QA_Result QAD_UARTMgr::registerUART(QAD_UART_Periph eUART) {
 	if (eUART >= QAD_UARTNone)
 		return QA_Fail;
 
-  if (m_sUARTs[eUART].eState)
+  if (m_eStates[eUART])
   	return QA_Error_PeriphBusy;
 
-  m_sUARTs[eUART].eState = QAD_UART_InUse;
+  m_eStates[eUART] = QAD_UART_InUse;
   return QA_OK;
 }
 
 
-//QAD_UARTMgr::imp_deregisterUART
-//QAD_UARTMgr Private Management Method
+//QAD_UARTMgr::deregisterUART
+//QAD_UARTMgr Management Method
 //
-//To be called from static method deregisterUART()
 //Used to deregister a UART peripheral to mark it as no longer being used by a driver
 //eUART - the UART peripheral to be deregistered. A member of QAD_UART_Periph
-void QAD_UARTMgr::imp_deregisterUART(QAD_UART_Periph eUART) {
+void QAD_UARTMgr::deregisterUART(QAD_UART_Periph eUART) {
 	if (eUART >= QAD_UARTNone)
 		return;
 
-  m_sUARTs[eUART].eState = QAD_UART_Unused;
+  m_eStates[eUART] = QAD_UART_Unused;
 }
 
 
-  //---------------------------------
-	//---------------------------------
-	//QAD_UARTMgr Private Clock Methods
+  //-------------------------
+	//-------------------------
+	//QAD_UARTMgr Clock Methods
 
-//QAD_UARTMgr::imp_enableClock
-//QAD_UARTMgr Private Clock Method
+//QAD_UARTMgr::enableClock
+//QAD_UARTMgr Clock Method
 //
-//To be called from static method enableClock()
 //Used to enable the clock for a specific UART peripheral
 //eUART - the UART peripheral to enable the clock for
-void QAD_UARTMgr::imp_enableClock(QAD_UART_Periph eUART) {
+void QAD_UARTMgr::enableClock(QAD_UART_Periph eUART) {
   switch (eUART) {
     case (QAD_UART1):
     	__HAL_RCC_USART1_CLK_ENABLE();
@@ -119,13 +104,12 @@ void QAD_UARTMgr::imp_enableClock(QAD_UART_Periph eUART) {
 }
 
 
-//QAD_UARTMgr::imp_disableClock
-//QAD_UARTMgr Private Clock Method
+//QAD_UARTMgr::disableClock
+//QAD_UARTMgr Clock Method
 //
-//To be called from static method disableClock()
 //Used to disable the clock for a specific UART peripheral
 //eUART - the UART peripheral to disable the clock for
-void QAD_UARTMgr::imp_disableClock(QAD_UART_Periph eUART) {
+void QAD_UARTMgr::disableClock(QAD_UART_Periph eUART) {
   switch (eUART) {
     case (QAD_UART1):
     	__HAL_RCC_USART1_CLK_DISABLE();
@@ -139,34 +123,32 @@ void QAD_UARTMgr::imp_disableClock(QAD_UART_Periph eUART) {
 }
 
 
-  //----------------------------------
-	//----------------------------------
-	//QAD_UARTMgr Private Status Methods
+  //--------------------------
+	//--------------------------
+	//QAD_UARTMgr Status Methods
 
-//QAD_UARTMgr::imp_getUARTsActive
-//QAD_UARTMgr Private Status Method
+//QAD_UARTMgr::getUARTsActive
+//QAD_UARTMgr Status Method
 //
-//To be called from static method getUARTsActive()
 //Returns the number of UART peripherals that are currently in-use (registered/active)
-uint8_t QAD_UARTMgr::imp_getUARTsActive(void) {
+uint8_t QAD_UARTMgr::getUARTsActive(void) {
   uint8_t uCount = 0;
   for (uint8_t i=0; i<QAD_UART_PeriphCount; i++) {
-  	if (m_sUARTs[i].eState)
+  	if (m_eStates[i])
   		uCount++;
   }
   return uCount;
 }
 
 
-//QAD_UARTMgr::imp_getUARTsInactive
-//QAD_UARTMgr Private Status Method
+//QAD_UARTMgr::getUARTsInactive
+//QAD_UARTMgr Status Method
 //
-//To be called from static method getUARTsInactive()
 //Returns the number of UART peripherals that are currently not being used (deregistered/inactive)
-uint8_t QAD_UARTMgr::imp_getUARTsInactive(void) {
+uint8_t QAD_UARTMgr::getUARTsInactive(void) {
   uint8_t uCount = 0;
   for (uint8_t i=0; i<QAD_UART_PeriphCount; i++) {
-  	if (!m_sUARTs[i].eState)
+  	if (!m_eStates[i])
   		uCount++;
   }
   return uCount;
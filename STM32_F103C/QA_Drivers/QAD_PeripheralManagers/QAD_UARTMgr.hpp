@@ -22,6 +22,8 @@
 //Includes
 #include "setup.hpp"
 
+#include "QAD_DMAMgr.hpp"
+
 
 	//------------------------------------------
 	//------------------------------------------
@@ -63,20 +65,25 @@ enum QAD_UART_State : uint8_t {
 
 
 //-------------
-//QAD_UART_Data
+//QAD_UART_Desc
 //
-//Structure used in array within QAD_UARTMgr class to hold information for UART peripherals
+//Structure used in constant table within QAD_UARTMgr class to hold the fixed hardware details of UART peripherals
+//All members are known at compile time, so lookups with a constant UART peripheral are folded to constants by the compiler
 typedef struct {
 
-	QAD_UART_Periph   eUART;      //Used to store which UART peripheral is represented by the structure, used for manager methods that find unused UARTs
+	QAD_UART_Periph   eUART;        //Used to store which UART peripheral is represented by the structure
+
+	uint32_t          uClockSpeed;  //Stores the input clock speed for the UART peripheral (defined in setup.hpp)
 
-	QAD_UART_State    eState;     //Stores whether the UART peripheral is currently being used or not
+	uint32_t          uBase;        //Stores the base address of the UART peripheral (USARTx_BASE defined in stm32f103x6.h)
+	                                //Stored as an address rather than a USART_TypeDef pointer, as a pointer cast is not permitted in a constant expression
 
-	USART_TypeDef*    pInstance;  //Stores the USART_TypeDef for the UART peripheral (defined in stm32f103x6.h)
+	IRQn_Type         eIRQ;         //Stores the IRQ Handler enum for the UART peripheral (defined in stm32f103x6.h)
 
-	IRQn_Type         eIRQ;       //Stores the IRQ Handler enum for the UART peripheral (defined in stm32f103x6.h)
+	QAD_DMA_Channel   eDMA_TX;      //Stores the DMA channel mapped to the UART peripheral's transmit DMA request
+	QAD_DMA_Channel   eDMA_RX;      //Stores the DMA channel mapped to the UART peripheral's receive DMA request
 
-} QAD_UART_Data;
+} QAD_UART_Desc;
 
 
 	//------------------------------------------
@@ -87,37 +94,34 @@ typedef struct {
 //-----------
 //QAD_UARTMgr
 //
-//Singleton class
+//Static class
 //Used to allow management of UART peripherals in order to make sure that a driver is prevented from accessing any
 //UART peripherals that are already being used by another driver
+//
+//Fixed hardware details are held in the constexpr m_sUARTs table, and the in-use state of each UART peripheral in the m_eStates array
 class QAD_UARTMgr {
 private:
 
-	//UART Peripheral Data
-	QAD_UART_Data m_sUARTs[QAD_UART_PeriphCount];
+	//UART Peripheral Descriptors
+	static constexpr QAD_UART_Desc m_sUARTs[QAD_UART_PeriphCount] = {
 
-	//------------
-	//Constructors
-	QAD_UARTMgr();
+		//eUART      uClockSpeed      uBase         eIRQ         eDMA_TX            eDMA_RX
+		{QAD_UART1,  QAD_CLOCK_PCLK2, USART1_BASE,  USART1_IRQn, QAD_DMA1_Channel4, QAD_DMA1_Channel5},
+		{QAD_UART2,  QAD_CLOCK_PCLK1, USART2_BASE,  USART2_IRQn, QAD_DMA1_Channel7, QAD_DMA1_Channel6}
+	};
+
+	//UART Peripheral States
+	static QAD_UART_State m_eStates[QAD_UART_PeriphCount];
 
 public:
 
-	//------------------------------------------------------------------------------
-	//Delete copy constructor and assignment operator due to being a singleton class
+	//--------------------------------------------------------------------
+	//Delete constructors and assignment operator due to being a static class
+	QAD_UARTMgr() = delete;
 	QAD_UARTMgr(const QAD_UARTMgr& other) = delete;
 	QAD_UARTMgr& operator=(const QAD_UARTMgr& other) = delete;
 
 
-	//-----------------
-	//Singleton Methods
-	//
-	//Used to retrieve a reference to the singleton class
-	static QAD_UARTMgr& get(void) {
-		static QAD_UARTMgr instance;
-		return instance;
-	}
-
-
 	//------------
 	//Data Methods
 
@@ -128,99 +132,88 @@ public:
 		if (eUART >= QAD_UARTNone)
 			return QAD_UART_InvalidDevice;
 
-		return get().m_sUARTs[eUART].eState;
+		return m_eStates[eUART];
+	}
+
+	//Used to retrieve the input clock speed of a UART peripheral
+	//eUART - The UART peripheral to retrieve the clock speed for. Member of QAD_UART_Periph
+	//Returns the frequency in Hz of the UART's input clock, or 0 if eUART is invalid
+	static constexpr uint32_t getClockSpeed(QAD_UART_Periph eUART) {
+		return (eUART < QAD_UARTNone) ? m_sUARTs[eUART].uClockSpeed : 0;
+	}
+
+	//Used to retrieve the base address of a UART peripheral
+	//eUART - The UART peripheral to retrieve the base address for. Member of QAD_UART_Periph
+	//Returns USARTx_BASE as defined in stm32f103x6.h, or 0 if eUART is invalid
+	static constexpr uint32_t getBase(QAD_UART_Periph eUART) {
+		return (eUART < QAD_UARTNone) ? m_sUARTs[eUART].uBase : 0;
 	}
 
 	//Used to retrieve an instance for a UART peripheral
 	//eUART - The UART peripheral to retrieve the instance for. Member of QAD_UART_Periph
-	//Returns USART_TypeDef, as defined in stm32f411xe.h
+	//Returns USART_TypeDef, as defined in stm32f103x6.h
 	static USART_TypeDef* getInstance(QAD_UART_Periph eUART) {
 		if (eUART >= QAD_UARTNone)
 			return NULL;
 
-		return get().m_sUARTs[eUART].pInstance;
+		return reinterpret_cast<USART_TypeDef*>(m_sUARTs[eUART].uBase);
 	}
 
 	//Used to retrieve an IRQ enum for a UART peripheral
 	//eUART - The UART peripheral to retrieve the IRQ enum for. Member of QAD_UART_Periph
-	//Returns member of IRQn_Type enum, as defined in stm32f411xe.h
-	static IRQn_Type getIRQ(QAD_UART_Periph eUART) {
-		if (eUART >= QAD_UARTNone)
-			return UsageFault_IRQn;
+	//Returns member of IRQn_Type enum, as defined in stm32f103x6.h
+	static constexpr IRQn_Type getIRQ(QAD_UART_Periph eUART) {
+		return (eUART < QAD_UARTNone) ? m_sUARTs[eUART].eIRQ : UsageFault_IRQn;
+	}
+
+	//Used to retrieve the DMA channel mapped to the transmit DMA request of a UART peripheral
+	//eUART - The UART peripheral to retrieve the DMA channel for. Member of QAD_UART_Periph
+	//Returns member of QAD_DMA_Channel enum
+	static constexpr QAD_DMA_Channel getDMAChannelTX(QAD_UART_Periph eUART) {
+		return (eUART < QAD_UARTNone) ? m_sUARTs[eUART].eDMA_TX : QAD_DMA_ChannelNone;
+	}
 
-		return get().m_sUARTs[eUART].eIRQ;
+	//Used to retrieve the DMA channel mapped to the receive DMA request of a UART peripheral
+	//eUART - The UART peripheral to retrieve the DMA channel for. Member of QAD_UART_Periph
+	//Returns member of QAD_DMA_Channel enum
+	static constexpr QAD_DMA_Channel getDMAChannelRX(QAD_UART_Periph eUART) {
+		return (eUART < QAD_UARTNone) ? m_sUARTs[eUART].eDMA_RX : QAD_DMA_ChannelNone;
 	}
 
 
+	//NOTE: See QAD_UARTMgr.cpp for details of the following methods
+
 	//-------------------
 	//Managemenet Methods
 
-	//Used to register a UART peripheral as being used by a driver
-	//eUART - the UART peripheral to be registered
-	//Returns QA_OK if registration is successful, or returns QA_Error_PeriphBusy if the selected UART is already in use
-	static QA_Result registerUART(QAD_UART_Periph eUART) {
-		return get().imp_registerUART(eUART);
-	}
-
-	//Used to deregister a UART peripheral to mark it as no longer being used by a driver
-	//eUART - the UART peripheral to be deregistered
-	static void deregisterUART(QAD_UART_Periph eUART) {
-		get().imp_deregisterUART(eUART);
-	}
+	static QA_Result registerUART(QAD_UART_Periph eUART);
+	static void deregisterUART(QAD_UART_Periph eUART);
 
 
 	//-------------
   //Clock Methods
 
-	//Used to enable the clock for a specific UART peripheral
-	//eUART - the UART peripheral to enable the clock for
-	static void enableClock(QAD_UART_Periph eUART) {
-		get().imp_enableClock(eUART);
-	}
-
-	//Used to disable the clock for a specific UART peripheral
-	//eUART - the UART peripheral to disable the clock for
-	static void disableClock(QAD_UART_Periph eUART) {
-		get().imp_disableClock(eUART);
-	}
+	static void enableClock(QAD_UART_Periph eUART);
+	static void disableClock(QAD_UART_Periph eUART);
 
 
 	//--------------
 	//Status Methods
 
-	//Returns the number of UART peripherals that are currently in-use (registered/active)
-	static uint8_t getUARTsActive(void) {
-		return get().imp_getUARTsActive();
-	}
-
-	//Returns the number of UART peripherals that are currently not being used (deregistered/inactive)
-	static uint8_t getUARTsInactive(void) {
-	  return get().imp_getUARTsInactive();
-	}
-
-
-private:
-
-	//NOTE: See QAD_UARTMgr.cpp for details of the following methods
+	static uint8_t getUARTsActive(void);
+	static uint8_t getUARTsInactive(void);
 
-	//------------------
-	//Management Methods
-	QA_Result imp_registerUART(QAD_UART_Periph eUART);
-	void imp_deregisterUART(QAD_UART_Periph eUART);
+};
 
 
-	//-------------
-	//Clock Methods
-	void imp_enableClock(QAD_UART_Periph eUART);
-	void imp_disableClock(QAD_UART_Periph eUART);
-
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
 
-	//--------------
-	//Status Methods
-	uint8_t imp_getUARTsActive(void);
-	uint8_t imp_getUARTsInactive(void);
 
-};
+//Compile time checks of UART descriptor table
+static_assert(QAD_UARTMgr::getBase(QAD_UART1) == USART1_BASE, "QAD_UARTMgr table entry for QAD_UART1 is out of order");
+static_assert(QAD_UARTMgr::getBase(QAD_UART2) == USART2_BASE, "QAD_UARTMgr table entry for QAD_UART2 is out of order");
 
 
 //Prevent Recursive Inclusion
@@ -0,0 +1,402 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Multi-Servo Driver                                              */
+/*   Filename: QAD_Servo.cpp                                               */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_Servo.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //--------------------------------
+  //--------------------------------
+  //QAD_Servo Initialization Methods
+
+//QAD_Servo::init
+//QAD_Servo Initialization Method
+//
+//Used to initialize the servo driver
+//Returns QA_OK if initialization successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
+//        QA_Fail if the servo count, pulse width range or servo GPIOs in the initialization structure are invalid
+QA_Result QAD_Servo::init(void) {
+
+	//Check initialization settings
+	if ((m_eTimer >= QAD_TimerNone) || (!m_uServoCount) || (m_uServoCount > (m_uChannels * QAD_SERVO_SLOTS)))
+		return QA_Fail;
+
+	if ((m_uMinPulse < QAD_SERVO_PULSE_MIN_US) || (m_uMaxPulse > QAD_SERVO_PULSE_MAX_US) || (m_uMinPulse > m_uMaxPulse))
+		return QA_Fail;
+
+	for (uint8_t i=0; i<m_uServoCount; i++) {
+		if (!m_pGPIO[i])
+			return QA_Fail;
+	}
+
+	//Register Timer peripheral as now being in use, which fails if it is currently in use
+	QA_Result eRes = QAD_TimerMgr::registerTimer(m_eTimer, QAD_Timer_InUse_Servo);
+	if (eRes)
+		return eRes;
+
+	//Initialize Timer peripheral
+	eRes = periphInit();
+
+	//If initialization failed then deregister Timer peripheral
+	if (eRes)
+		QAD_TimerMgr::deregisterTimer(m_eTimer);
+
+	//Return initialization result
+	return eRes;
+}
+
+
+//QAD_Servo::deinit
+//QAD_Servo Initialization Method
+//
+//Used to deinitialize the servo driver
+void QAD_Servo::deinit(void) {
+
+	//Return if driver is not currently initialized
+	if (!m_eInitState)
+		return;
+
+	//Deinitialize driver
+	periphDeinit(DeinitFull);
+
+	//Deregister Timer peripheral
+	QAD_TimerMgr::deregisterTimer(m_eTimer);
+}
+
+
+  //-----------------------------
+  //-----------------------------
+  //QAD_Servo IRQ Handler Methods
+
+//QAD_Servo::handler
+//QAD_Servo IRQ Handler Method
+//
+//This method is only to be called by the interrupt request handler function(s) of the selected timer from handlers.cpp
+//Interrupt flags are only processed if their interrupt is enabled, as the flags are set by the hardware regardless
+//The update event starts each frame, and the compare event of each channel ends the current pulse or starts the next one
+void QAD_Servo::handler(void) {
+	TIM_TypeDef* pTimer = m_sHandle.Instance;
+	uint32_t     uFlags = pTimer->SR & pTimer->DIER;
+
+	//Check for start of frame
+	if (uFlags & TIM_SR_UIF) {
+		pTimer->SR = ~TIM_SR_UIF;
+		startFrame();
+	}
+
+	//Check for compare events of each channel
+	for (uint8_t i=0; i<m_uChannels; i++) {
+		if (uFlags & (TIM_SR_CC1IF << i)) {
+			pTimer->SR = ~(TIM_SR_CC1IF << i);
+			processChannel(i);
+		}
+	}
+}
+
+
+  //-------------------------
+  //-------------------------
+  //QAD_Servo Control Methods
+
+//QAD_Servo::setFrameHandler
+//QAD_Servo Control Method
+//
+//Used to set the callback delegate to be called at the start of each frame, once any values committed by update() have been applied
+//The delegate's event data (pData) is a pointer to this QAD_Servo driver
+//sHandler - The callback delegate (QAT_Delegate defined in QAT_Delegate.hpp)
+void QAD_Servo::setFrameHandler(const QAT_Delegate& sHandler) {
+	m_sFrameHandler = sHandler;
+}
+
+
+//QAD_Servo::start
+//QAD_Servo Control Method
+//
+//Starts generating servo pulses. An update event is generated so that the first frame starts immediately
+void QAD_Servo::start(void) {
+
+	//Check if driver is initialized and is currently not active
+	if ((m_eInitState) && (!m_eState)) {
+		TIM_TypeDef* pTimer = m_sHandle.Instance;
+
+		//Reset frame count, and enable update interrupt only, as compare interrupts are enabled by each frame
+		m_uFrames    = 0;
+		pTimer->SR   = 0;
+		pTimer->DIER = TIM_DIER_UIE;
+
+		//Generate update event to reset counter and start first frame, then enable timer
+		pTimer->EGR  = TIM_EGR_UG;
+		__HAL_TIM_ENABLE(&m_sHandle);
+
+		//Set current driver state to active
+		m_eState = QA_Active;
+	}
+}
+
+
+//QAD_Servo::stop
+//QAD_Servo Control Method
+//
+//Stops generating servo pulses. All servo pins are set low, which truncates any pulse that is in progress
+void QAD_Servo::stop(void) {
+
+	//Check if driver is initialized and is currently active
+	if ((m_eInitState) && (m_eState)) {
+		uint32_t uPriMask = __get_PRIMASK();
+		__disable_irq();
+
+		//Disable timer and interrupts
+		__HAL_TIM_DISABLE(&m_sHandle);
+		m_sHandle.Instance->DIER = 0;
+		m_sHandle.Instance->SR   = 0;
+
+		//Set all servo pins low
+		for (uint8_t i=0; i<m_uServoCount; i++)
+			m_pGPIO[i]->BSRR = (uint32_t)m_uPin[i] << 16;
+
+		__set_PRIMASK(uPriMask);
+
+		//Set current driver state to inactive
+		m_eState = QA_Inactive;
+	}
+}
+
+
+//QAD_Servo::setPulse
+//QAD_Servo Control Method
+//
+//Used to stage the pulse width of a servo. The new value is not output until update() is called
+//This method is not to be called from interrupts, as staged values are not protected from concurrent access
+//uServo    - Index of the servo (between 0 and the servo count - 1)
+//uPulse_us - Pulse width in microseconds, which is clamped to the range set in the initialization structure
+void QAD_Servo::setPulse(uint8_t uServo, uint16_t uPulse_us) {
+	if (uServo >= m_uServoCount)
+		return;
+
+	m_uStaged[uServo] = clampPulse(uPulse_us);
+}
+
+
+//QAD_Servo::update
+//QAD_Servo Control Method
+//
+//Used to commit all staged pulse widths, which are applied together at the start of the next frame
+//If update() is called more than once before the next frame starts, only the most recently committed values are applied
+void QAD_Servo::update(void) {
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	for (uint8_t i=0; i<m_uServoCount; i++)
+		m_uPending[i] = m_uStaged[i];
+	m_bPending = true;
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+  //----------------------
+  //----------------------
+  //QAD_Servo Data Methods
+
+//QAD_Servo::getPulse
+//QAD_Servo Data Method
+//
+//Returns the staged pulse width of a servo in microseconds, or 0 if uServo is not valid
+//uServo - Index of the servo (between 0 and the servo count - 1)
+uint16_t QAD_Servo::getPulse(uint8_t uServo) {
+	if (uServo >= m_uServoCount)
+		return 0;
+
+	return m_uStaged[uServo];
+}
+
+
+//QAD_Servo::getFrameCount
+//QAD_Servo Data Method
+//
+//Returns the number of frames started since start() was called
+uint32_t QAD_Servo::getFrameCount(void) {
+	return m_uFrames;
+}
+
+
+  //----------------------------------------
+  //----------------------------------------
+  //QAD_Servo Private Initialization Methods
+
+//QAD_Servo::periphInit
+//QAD_Servo Private Initialization Method
+//
+//Used to initialize the servo GPIOs, timer peripheral clock and the timer peripheral itself, and to enable the interrupts
+//In the case of a failed initialization, a partial deinitialization will be performed to make sure the peripheral and clock
+//are all in the uninitialized state
+//Returns QA_OK if successful, or QA_Fail if initialization fails
+QA_Result QAD_Servo::periphInit(void) {
+
+	//Init GPIOs as outputs, which are set low before being initialized
+	GPIO_InitTypeDef GPIO_Init = {0};
+	GPIO_Init.Mode     = GPIO_MODE_OUTPUT_PP;  //Set pin to Output - Push/Pull mode
+	GPIO_Init.Pull     = GPIO_NOPULL;          //Disable pull-up and pull-down resistors
+	GPIO_Init.Speed    = GPIO_SPEED_FREQ_LOW;  //Set pin output speed to low
+
+	for (uint8_t i=0; i<m_uServoCount; i++) {
+		m_pGPIO[i]->BSRR = (uint32_t)m_uPin[i] << 16;
+		GPIO_Init.Pin    = m_uPin[i];
+		HAL_GPIO_Init(m_pGPIO[i], &GPIO_Init);
+	}
+
+	//Enable Timer Clock
+	QAD_TimerMgr::enableClock(m_eTimer);
+
+	//Initialize timer to count microseconds with a period of one frame
+	m_sHandle.Instance               = QAD_TimerMgr::getInstance(m_eTimer);                 //Set instance for Timer peripheral
+	m_sHandle.Init.Prescaler         = (QAD_TimerMgr::getClockSpeed(m_eTimer) / 1000000) - 1;  //Set prescaler for 1MHz counter clock
+	m_sHandle.Init.CounterMode       = TIM_COUNTERMODE_UP;                                  //Set timer counter mode to count up
+	m_sHandle.Init.Period            = QAD_SERVO_FRAME_US - 1;                              //Set timer counter period to one frame
+	m_sHandle.Init.ClockDivision     = TIM_CLOCKDIVISION_DIV1;                              //Unused
+	m_sHandle.Init.RepetitionCounter = 0x0;                                                 //
+	m_sHandle.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;                      //Preload not required as period is never changed
+
+	if (HAL_TIM_Base_Init(&m_sHandle) != HAL_OK) {
+		periphDeinit(DeinitPartial);
+		return QA_Fail;
+	}
+
+	//Compare registers are left in frozen output compare mode with preload disabled, so each new compare value takes effect immediately
+	//Only the compare interrupts are used, as the servo pins are driven by software
+	m_sHandle.Instance->SR = 0;
+
+	//Set IRQ priorities and enable IRQs. These are the same IRQ for general purpose timers
+	HAL_NVIC_SetPriority(QAD_TimerMgr::getUpdateIRQ(m_eTimer), m_uIRQPriority, 0);
+	HAL_NVIC_SetPriority(QAD_TimerMgr::getCCIRQ(m_eTimer), m_uIRQPriority, 0);
+	HAL_NVIC_EnableIRQ(QAD_TimerMgr::getUpdateIRQ(m_eTimer));
+	HAL_NVIC_EnableIRQ(QAD_TimerMgr::getCCIRQ(m_eTimer));
+
+	//Set driver states
+	m_eState     = QA_Inactive;    //Set driver as currently inactive
+	m_eInitState = QA_Initialized; //Set driver state as initialized
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_Servo::periphDeinit
+//QAD_Servo Private Initialization Method
+//
+//Used to deinitialize the servo GPIOs, timer peripheral clock and the timer peripheral itself, as well as disabling the interrupts
+//eDeinitMode - Set to DeinitPartial to perform a partial deinitialization (only to be used by periphInit() method
+//              in a case where peripheral initialization has failed
+//            - Set to DeinitFull to perform a full deinitialization in a case where the driver is fully initialized
+void QAD_Servo::periphDeinit(QAD_Servo::DeinitMode eDeinitMode) {
+
+	//Check if full deinitialization is required
+	if (eDeinitMode) {
+
+		//Disable IRQs
+		HAL_NVIC_DisableIRQ(QAD_TimerMgr::getUpdateIRQ(m_eTimer));
+		HAL_NVIC_DisableIRQ(QAD_TimerMgr::getCCIRQ(m_eTimer));
+
+		//Deinitialize Timer peripheral
+		HAL_TIM_Base_DeInit(&m_sHandle);
+	}
+
+	//Disable Timer Clock
+	QAD_TimerMgr::disableClock(m_eTimer);
+
+	//Deinitialize GPIOs
+	for (uint8_t i=0; i<m_uServoCount; i++)
+		HAL_GPIO_DeInit(m_pGPIO[i], m_uPin[i]);
+
+	//Set States
+	m_eState     = QA_Inactive;       //Set driver as currently inactive
+	m_eInitState = QA_NotInitialized; //Set driver state as not initialized
+}
+
+
+  //---------------------------------
+  //---------------------------------
+  //QAD_Servo Private Control Methods
+
+//QAD_Servo::startFrame
+//QAD_Servo Private Control Method
+//
+//Called by the update event at the start of each frame
+//Applies any pulse widths committed by update(), then starts the pulse of the first servo of each channel, with the channel's compare
+//register being set to the end of the pulse
+void QAD_Servo::startFrame(void) {
+	TIM_TypeDef* pTimer = m_sHandle.Instance;
+
+	//Apply committed pulse widths
+	if (m_bPending) {
+		for (uint8_t i=0; i<m_uServoCount; i++)
+			m_uActive[i] = m_uPending[i];
+		m_bPending = false;
+	}
+
+	//Start pulse of first slot of each channel that has servos
+	for (uint8_t i=0; (i<m_uChannels) && (i<m_uServoCount); i++) {
+		m_uSlot[i] = 0;
+		m_bHigh[i] = true;
+		m_pGPIO[i]->BSRR    = m_uPin[i];
+		(&pTimer->CCR1)[i]  = m_uActive[i];
+		pTimer->SR          = ~(TIM_SR_CC1IF << i);
+		pTimer->DIER       |= (TIM_DIER_CC1IE << i);
+	}
+
+	//Count frame and call frame handler
+	m_uFrames++;
+	m_sFrameHandler(this);
+}
+
+
+//QAD_Servo::processChannel
+//QAD_Servo Private Control Method
+//
+//Called by the compare event of a channel, to either end the pulse of the current slot or start the pulse of the next slot
+//When the channel's last servo pulse has ended its compare interrupt is disabled until the start of the next frame
+//uChannel - Index of the timer channel
+void QAD_Servo::processChannel(uint8_t uChannel) {
+	TIM_TypeDef* pTimer = m_sHandle.Instance;
+	uint8_t      uServo = uChannel + (m_uSlot[uChannel] * m_uChannels);
+
+	if (m_bHigh[uChannel]) {
+
+		//End pulse of current slot
+		m_pGPIO[uServo]->BSRR = (uint32_t)m_uPin[uServo] << 16;
+		m_bHigh[uChannel]     = false;
+
+		//Set compare register to start of next slot, or disable compare interrupt if channel has no further servos in this frame
+		if ((uServo + m_uChannels) < m_uServoCount)
+			(&pTimer->CCR1)[uChannel] = (m_uSlot[uChannel] + 1) * QAD_SERVO_SLOT_US;
+		else
+			pTimer->DIER &= ~(TIM_DIER_CC1IE << uChannel);
+
+	} else {
+
+		//Start pulse of next slot, and set compare register to the end of the pulse
+		m_uSlot[uChannel]++;
+		uServo += m_uChannels;
+		m_pGPIO[uServo]->BSRR     = m_uPin[uServo];
+		(&pTimer->CCR1)[uChannel] = (m_uSlot[uChannel] * QAD_SERVO_SLOT_US) + m_uActive[uServo];
+		m_bHigh[uChannel]         = true;
+	}
+}
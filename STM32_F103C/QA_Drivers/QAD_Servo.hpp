@@ -0,0 +1,259 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Multi-Servo Driver                                              */
+/*   Filename: QAD_Servo.hpp                                               */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_SERVO_HPP_
+#define __QAD_SERVO_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_TimerMgr.hpp"
+#include "QAT_Delegate.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------------
+//QAD_SERVO_SLOTS
+//
+//Number of servo pulses sequenced by each timer channel within each frame
+#define QAD_SERVO_SLOTS         8
+
+
+//---------------
+//QAD_SERVO_COUNT
+//
+//Maximum number of servos supported by the QAD_Servo driver (four timer channels each sequencing QAD_SERVO_SLOTS servos)
+#define QAD_SERVO_COUNT         (4 * QAD_SERVO_SLOTS)
+
+
+//------------------
+//QAD_SERVO_FRAME_US
+//
+//Frame period in microseconds, in which every servo receives one pulse (50Hz)
+//Each frame is divided into QAD_SERVO_SLOTS slots of QAD_SERVO_SLOT_US, with one servo per channel being pulsed in each slot
+#define QAD_SERVO_FRAME_US      20000
+#define QAD_SERVO_SLOT_US       (QAD_SERVO_FRAME_US / QAD_SERVO_SLOTS)
+
+
+//----------------------
+//QAD_SERVO_PULSE_MIN_US
+//
+//Limits of the pulse width range that can be set in the initialization structure. The maximum leaves a gap before the start of the
+//following slot so that the end of one pulse and the start of the next are never handled by the same compare event
+#define QAD_SERVO_PULSE_MIN_US  100
+#define QAD_SERVO_PULSE_MAX_US  (QAD_SERVO_SLOT_US - 50)
+
+
+//-------------------
+//QAD_Servo_InitServo
+//
+//This structure is used to store data specific to individual servos
+typedef struct {
+
+	GPIO_TypeDef*  pGPIO;      //GPIO port to be used by this servo. Any GPIO pin can be used
+	uint16_t       uPin;       //Pin number to be used by this servo
+	uint16_t       uPulse_us;  //Initial pulse width in microseconds
+
+} QAD_Servo_InitServo;
+
+
+//--------------------
+//QAD_Servo_InitStruct
+//
+//This structure is used to be able to create the QAD_Servo driver class
+typedef struct {
+
+	QAD_Timer_Periph    eTimer;         //Timer peripheral to be used. Member of QAD_Timer_Periph as defined in QAD_TimerMgr.hpp
+	uint8_t             uIRQPriority;   //IRQ Priority for the timer's update and capture/compare interrupts (a value between 0 and 15)
+	                                    //This should be a high priority, as any interrupt latency is added to the servo pulses
+
+	uint8_t             uServoCount;    //Number of servos (between 1 and QAD_SERVO_COUNT)
+	uint16_t            uMinPulse_us;   //Minimum pulse width in microseconds that can be set (no lower than QAD_SERVO_PULSE_MIN_US)
+	uint16_t            uMaxPulse_us;   //Maximum pulse width in microseconds that can be set (no higher than QAD_SERVO_PULSE_MAX_US)
+
+	QAD_Servo_InitServo sServos[QAD_SERVO_COUNT];  //Data for individual servos
+
+} QAD_Servo_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//---------
+//QAD_Servo
+//
+//Driver class used to generate hobby servo pulses for up to QAD_SERVO_COUNT servos using a single Timer peripheral
+//
+//The timer counts microseconds with a period of one 20ms frame. Each of the timer's four channels is used in output compare mode to
+//sequence up to QAD_SERVO_SLOTS servos, one per 2.5ms slot, with the servo pins being set and cleared by the compare interrupt. Servos
+//are assigned to channels in turn, so servo n is sequenced by channel (n % 4) in slot (n / 4). As the pins are driven by software, any
+//GPIO pins can be used, and the timer's own channel pins remain free.
+//
+//Pulse widths are set in microseconds using setPulse(), which only stages the new value. update() then commits all staged values together,
+//and they are applied at the start of the following frame, so no servo ever receives a pulse from a partially updated set of values.
+//The frame handler delegate is called at the start of each frame, and can be used to pace updates to the frame rate.
+//
+//The handler() method is to be called from the IRQ handler function of the selected timer within handlers.cpp. For Timer 1 both the
+//update (TIM1_UP_IRQn) and capture/compare (TIM1_CC_IRQn) IRQs are used.
+class QAD_Servo {
+private:
+
+	//Deinitialization mode to be used by periphDeinit() method
+	enum DeinitMode : uint8_t {
+		DeinitPartial = 0,        //Only to be used for partial deinitialization upon initialization failure in periphInit() method
+		DeinitFull                //Used for full driver deinitialization when driver is in a fully initialized state
+	};
+
+	QA_InitState      m_eInitState;    //Stores whether the driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+	QA_ActiveState    m_eState;        //Stores whether the driver is currently active. Member of QA_ActiveState enum defined in setup.hpp
+
+	QAD_Timer_Periph  m_eTimer;        //Stores the Timer peripheral to be used by the driver
+	TIM_HandleTypeDef m_sHandle;       //Handle used by HAL functions to access Timer peripheral (defined in stm32f1xx_hal_tim.h)
+	uint8_t           m_uIRQPriority;  //IRQ Priority for the timer's interrupts
+
+	uint8_t           m_uServoCount;   //Number of servos
+	uint8_t           m_uChannels;     //Number of timer channels used to sequence the servos
+	uint16_t          m_uMinPulse;     //Minimum pulse width in microseconds
+	uint16_t          m_uMaxPulse;     //Maximum pulse width in microseconds
+
+	GPIO_TypeDef*     m_pGPIO[QAD_SERVO_COUNT];      //GPIO port of each servo
+	uint16_t          m_uPin[QAD_SERVO_COUNT];       //Pin number of each servo
+
+	uint16_t          m_uStaged[QAD_SERVO_COUNT];    //Pulse widths staged by setPulse()
+	uint16_t          m_uPending[QAD_SERVO_COUNT];   //Pulse widths committed by update(), to be applied at the start of the next frame
+	uint16_t          m_uActive[QAD_SERVO_COUNT];    //Pulse widths of the current frame
+	volatile bool     m_bPending;                    //Set when committed pulse widths are waiting to be applied
+
+	uint8_t           m_uSlot[4];      //Current slot of each timer channel
+	bool              m_bHigh[4];      //Stores whether the current slot's pulse of each timer channel is in progress
+
+	volatile uint32_t m_uFrames;       //Number of frames started since start() was called
+	QAT_Delegate      m_sFrameHandler; //Callback delegate to be called at the start of each frame (QAT_Delegate defined in QAT_Delegate.hpp)
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+	QAD_Servo() = delete;                     //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+	QAD_Servo(QAD_Servo_InitStruct& sInit) :  //The class constructor to be used, which has a reference to an initialization structure passed to it
+		m_eInitState(QA_NotInitialized),
+		m_eState(QA_Inactive),
+		m_eTimer(sInit.eTimer),
+		m_sHandle({0}),
+		m_uIRQPriority(sInit.uIRQPriority),
+		m_uServoCount(sInit.uServoCount),
+		m_uChannels((sInit.eTimer < QAD_TimerNone) ? QAD_TimerMgr::getChannels(sInit.eTimer) : 0),
+		m_uMinPulse(sInit.uMinPulse_us),
+		m_uMaxPulse(sInit.uMaxPulse_us),
+		m_bPending(false),
+		m_uSlot(),
+		m_bHigh(),
+		m_uFrames(0),
+		m_sFrameHandler() {
+
+		//Copy servo data from initialization structure, clamping initial pulse widths to the pulse width range
+		for (uint8_t i=0; i<QAD_SERVO_COUNT; i++) {
+			m_pGPIO[i]    = sInit.sServos[i].pGPIO;
+			m_uPin[i]     = sInit.sServos[i].uPin;
+			m_uStaged[i]  = clampPulse(sInit.sServos[i].uPulse_us);
+			m_uPending[i] = m_uStaged[i];
+			m_uActive[i]  = m_uStaged[i];
+		}
+	}
+
+	~QAD_Servo() {         //Destructor to make sure peripheral is made inactive and deinitialized upon class destruction
+
+		//Stop servo driver if currently active
+		if (m_eState)
+			stop();
+
+		//Deinitialize servo driver if currently initialized
+		if (m_eInitState)
+			deinit();
+	}
+
+
+	//NOTE: See QAD_Servo.cpp for details of the following functions
+
+	//----------------------
+	//Initialization Methods
+
+	QA_Result init(void);
+	void deinit(void);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	void handler(void);
+
+
+	//---------------
+	//Control Methods
+
+	void setFrameHandler(const QAT_Delegate& sHandler);
+
+	void start(void);
+	void stop(void);
+
+	void setPulse(uint8_t uServo, uint16_t uPulse_us);
+	void update(void);
+
+
+	//------------
+	//Data Methods
+
+	uint16_t getPulse(uint8_t uServo);
+	uint32_t getFrameCount(void);
+
+private:
+
+	//------------------------------
+	//Private Initialization Methods
+
+	QA_Result periphInit(void);
+	void periphDeinit(DeinitMode eDeinitMode);
+
+
+	//--------------------
+	//Private Data Methods
+
+	//Returns a pulse width clamped to the range set in the initialization structure
+	uint16_t clampPulse(uint16_t uPulse_us) {
+		return (uPulse_us < m_uMinPulse) ? m_uMinPulse : ((uPulse_us > m_uMaxPulse) ? m_uMaxPulse : uPulse_us);
+	}
+
+
+	//-----------------------
+	//Private Control Methods
+
+	void startFrame(void);
+	void processChannel(uint8_t uChannel);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_SERVO_HPP_ */
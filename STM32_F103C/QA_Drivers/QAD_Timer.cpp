@@ -99,13 +99,9 @@ void QAD_Timer::handler(void) {
   	    break;
   	}
 
-  	//If a handler callback function has been assigned then call it
-  	if (m_pHandlerFunction)
-  		m_pHandlerFunction(NULL);
-
-  	//If a handler callback class has been assigned then call it's handler() method
-  	if (m_pHandlerClass)
-  		m_pHandlerClass->handler(NULL);
+  	//Call handler callback delegate, passing a pointer to this driver as the event data
+  	//An unbound delegate calls an empty stub, so no check is required
+  	m_sHandler(this);
 
   	//Clear Update Interrupt flag
   	__HAL_TIM_CLEAR_FLAG(&m_sHandle, TIM_FLAG_UPDATE);
@@ -117,13 +113,25 @@ void QAD_Timer::handler(void) {
   //-------------------------
   //QAD_Timer Control Methods
 
+//QAD_Timer::setHandler
+//QAD_Timer Control Method
+//
+//Used to set the interrupt handler callback delegate to be called when the timer update interrupt is triggered
+//The delegate's event data (pData) is a pointer to this QAD_Timer driver
+//sHandler - The callback delegate (QAT_Delegate defined in QAT_Delegate.hpp)
+void QAD_Timer::setHandler(const QAT_Delegate& sHandler) {
+	m_sHandler = sHandler;
+}
+
+
 //QAD_Timer::setHandlerFunction
 //QAD_Timer Control Method
 //
 //Used to set the interrupt handler callback function to be called when the timer update interrupt is triggered
+//Replaces any previously set handler callback
 //pHandler - Pointer to callback function based on QAD_IRQHandler_CallbackFunction prototype defined in setup.hpp
 void QAD_Timer::setHandlerFunction(QAD_IRQHandler_CallbackFunction pHandler) {
-  m_pHandlerFunction = pHandler;
+  m_sHandler = QAT_Delegate::fromCallbackFunction(pHandler);
 }
 
 
@@ -131,9 +139,10 @@ void QAD_Timer::setHandlerFunction(QAD_IRQHandler_CallbackFunction pHandler) {
 //QAD_Timer Control Method
 //
 //Used to set the interrupt handler callback class to be called when the timer update interrupt is triggered
+//Replaces any previously set handler callback
 //pHandler - Pointer to callback class based on QAD_IRQHandler_CallbackClass defined in setup.hpp
 void QAD_Timer::setHandlerClass(QAD_IRQHandler_CallbackClass* pHandler) {
-  m_pHandlerClass = pHandler;
+  m_sHandler = QAT_Delegate::fromCallbackClass(pHandler);
 }
 
 
@@ -238,6 +247,64 @@ void QAD_Timer::stop(void) {
 }
 
 
+//QAD_Timer::setFrequency
+//QAD_Timer Control Method
+//
+//Used to set the update interrupt frequency, with the prescaler and period being found by QAD_TimerMgr::calcFrequency()
+//If the driver is running, the new prescaler and period are written to the preload registers with update events disabled, so that
+//both take effect together at the end of the current period with no shortened or corrupted period
+//uFrequency - The required frequency in Hz. Use getFrequency() to retrieve the frequency actually achieved
+//Returns QA_OK if successful, or QA_Fail if the frequency cannot be produced by the timer peripheral
+QA_Result QAD_Timer::setFrequency(uint32_t uFrequency) {
+
+	//Find prescaler and period for the required frequency
+	QAD_Timer_FreqConfig sConfig = QAD_TimerMgr::calcFrequency(m_eTimer, uFrequency, 0);
+	if (!sConfig.bValid)
+		return QA_Fail;
+
+	m_uPrescaler = sConfig.uPrescaler;
+	m_uPeriod    = sConfig.uPeriod;
+
+	//If driver is not initialized then the new values will be used by periphInit()
+	if (!m_eInitState)
+		return QA_OK;
+
+	m_sHandle.Init.Prescaler = m_uPrescaler;
+	m_sHandle.Init.Period    = m_uPeriod;
+
+	//Write preload registers with update events disabled, within a critical section to prevent the update interrupt
+	//from stopping the timer part way through
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	m_sHandle.Instance->CR1 |= TIM_CR1_UDIS;
+	m_sHandle.Instance->PSC  = m_uPrescaler;
+	m_sHandle.Instance->ARR  = m_uPeriod;
+	m_sHandle.Instance->CR1 &= ~TIM_CR1_UDIS;
+
+	//If timer is not running then generate an update event to load the new values immediately
+	//The update flag set by this is cleared so that an interrupt is not triggered when the timer is started
+	if (!m_eState) {
+		m_sHandle.Instance->EGR = TIM_EGR_UG;
+		__HAL_TIM_CLEAR_FLAG(&m_sHandle, TIM_FLAG_UPDATE);
+	}
+
+	__set_PRIMASK(uPriMask);
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_Timer::getFrequency
+//QAD_Timer Control Method
+//
+//Returns the update interrupt frequency in Hz produced by the current prescaler and period, rounded to the nearest Hz
+uint32_t QAD_Timer::getFrequency(void) {
+	return QAD_TimerMgr::getFrequency(m_eTimer, m_uPrescaler, m_uPeriod);
+}
+
+
   //----------------------------------------
   //----------------------------------------
   //QAD_Timer Private Initialization Methods
@@ -23,6 +23,7 @@
 #include "setup.hpp"
 
 #include "QAD_TimerMgr.hpp"
+#include "QAT_Delegate.hpp"
 
 
 	//------------------------------------------
@@ -96,12 +97,7 @@ private:
 
 	IRQn_Type         m_eIRQ;          //The IRQ used by the Timer peripheral being used (a member of IRQn_Type defined in stm32f103x6.h)
 
-	QAD_IRQHandler_CallbackFunction m_pHandlerFunction;  //A pointer to the callback function to be called when update interrupt triggered
-	                                                     //QAD_IRQHandler_CallbackFunction defined in setup.hpp
-
-	QAD_IRQHandler_CallbackClass*   m_pHandlerClass;     //A pointer to the callback class to be called when update interrupt is triggered
-	                                                     //The handler() pure virtual function is the method that is called, and is to be implemented by the parent class
-	                                                     //QAD_IRQHandler_CallbackClass defined in setup.hpp
+	QAT_Delegate      m_sHandler;      //Callback delegate to be called when update interrupt is triggered (QAT_Delegate defined in QAT_Delegate.hpp)
 
 	uint16_t          m_uIRQCounterTarget;  //Counter target value to be used when m_eMode is set to QAD_TimerMultiple
 	uint16_t          m_uIRQCounterValue;   //Current counter value to be used when m_eMode is set to QAD_TimerMultiple
@@ -122,11 +118,20 @@ public:
 		m_uIRQPriority(sInit.uIRQPriority),
 		m_eInitState(QA_NotInitialized),
 		m_eState(QA_Inactive),
-		m_pHandlerFunction(NULL),
-		m_pHandlerClass(NULL),
+		m_sHandler(),
 		m_uIRQCounterTarget(sInit.uCounterTarget),
 		m_uIRQCounterValue(0) {}
 
+	QAD_Timer(QAD_Timer_InitStruct& sInit, uint32_t uFrequency) :  //Constructor to set the update frequency in Hz, with uPrescaler and uPeriod of the
+		QAD_Timer(sInit) {                                          //initialization structure only being used if the frequency cannot be produced
+
+		QAD_Timer_FreqConfig sConfig = QAD_TimerMgr::calcFrequency(m_eTimer, uFrequency, 0);
+		if (sConfig.bValid) {
+			m_uPrescaler = sConfig.uPrescaler;
+			m_uPeriod    = sConfig.uPeriod;
+		}
+	}
+
 	~QAD_Timer() {         //Destructor to make sure peripheral is made inactive and deinitialized upon class destruction
 
 		//Stop timer driver if currently active
@@ -157,6 +162,7 @@ public:
 	//---------------
 	//Control Methods
 
+  void setHandler(const QAT_Delegate& sHandler);
   void setHandlerFunction(QAD_IRQHandler_CallbackFunction pHandler);
   void setHandlerClass(QAD_IRQHandler_CallbackClass* pHandler);
 
@@ -172,6 +178,9 @@ public:
   void start(void);
   void stop(void);
 
+  QA_Result setFrequency(uint32_t uFrequency);
+  uint32_t getFrequency(void);
+
 private:
 
   //------------------------------
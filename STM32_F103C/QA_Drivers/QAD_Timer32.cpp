@@ -0,0 +1,456 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Chained 32bit Timer Driver                                      */
+/*   Filename: QAD_Timer32.cpp                                             */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_Timer32.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //----------------------------------
+  //----------------------------------
+  //QAD_Timer32 Initialization Methods
+
+//QAD_Timer32::init
+//QAD_Timer32 Initialization Method
+//
+//Used to initialize the 32bit timer driver
+//Returns QA_OK if initialization successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
+QA_Result QAD_Timer32::init(void) {
+
+	//Check that a valid Timer pair has been selected
+	if (m_ePair >= QAD_TimerPairNone)
+		return QA_Fail;
+
+	//Register both Timer peripherals of the pair as now being in use, which fails if either is currently in use
+	QA_Result eRes = QAD_TimerMgr::registerTimerPair(m_ePair);
+	if (eRes)
+		return eRes;
+
+	//Initialize Timer peripherals
+	eRes = periphInit();
+
+	//If initialization failed then deregister Timer peripherals
+	if (eRes)
+		QAD_TimerMgr::deregisterTimerPair(m_ePair);
+
+	//Return initialization result
+	return eRes;
+}
+
+
+//QAD_Timer32::deinit
+//QAD_Timer32 Initialization Method
+//
+//Used to deinitialize the 32bit timer driver
+void QAD_Timer32::deinit(void) {
+
+	//Return if driver is not currently initialized
+	if (!m_eInitState)
+		return;
+
+	//Deinitialize driver
+	periphDeinit(DeinitFull);
+
+	//Deregister Timer peripherals
+	QAD_TimerMgr::deregisterTimerPair(m_ePair);
+}
+
+
+  //-------------------------------
+  //-------------------------------
+  //QAD_Timer32 IRQ Handler Methods
+
+//QAD_Timer32::handler
+//QAD_Timer32 IRQ Handler Method
+//
+//This method is only to be called by the interrupt request handler functions of both the master and slave timers from handlers.cpp
+//Interrupt flags are only processed if their interrupt is enabled, as the flags are set by the hardware regardless
+void QAD_Timer32::handler(void) {
+	TIM_TypeDef* pMaster = m_sMaster.Instance;
+	TIM_TypeDef* pSlave  = m_sSlave.Instance;
+
+	//Check for 32bit counter overflow (slave timer update event)
+	if ((pSlave->SR & TIM_SR_UIF) && (pSlave->DIER & TIM_DIER_UIE)) {
+		pSlave->SR = ~TIM_SR_UIF;
+		m_sOverflowHandler(this);
+	}
+
+	//Check for first stage of alarm (high half of count reached), and arm second stage
+	if ((pSlave->SR & TIM_SR_CC1IF) && (pSlave->DIER & TIM_DIER_CC1IE)) {
+		pSlave->DIER &= ~TIM_DIER_CC1IE;
+		pSlave->SR    = ~TIM_SR_CC1IF;
+		armAlarmLow();
+	}
+
+	//Check for second stage of alarm (full count reached)
+	if ((pMaster->SR & TIM_SR_CC1IF) && (pMaster->DIER & TIM_DIER_CC1IE)) {
+		pMaster->DIER &= ~TIM_DIER_CC1IE;
+		pMaster->SR    = ~TIM_SR_CC1IF;
+		m_sAlarmHandler(this);
+	}
+}
+
+
+  //---------------------------
+  //---------------------------
+  //QAD_Timer32 Control Methods
+
+//QAD_Timer32::setOverflowHandler
+//QAD_Timer32 Control Method
+//
+//Used to set the callback delegate to be called when the 32bit counter overflows
+//The delegate's event data (pData) is a pointer to this QAD_Timer32 driver
+//sHandler - The callback delegate (QAT_Delegate defined in QAT_Delegate.hpp)
+void QAD_Timer32::setOverflowHandler(const QAT_Delegate& sHandler) {
+	m_sOverflowHandler = sHandler;
+}
+
+
+//QAD_Timer32::setAlarmHandler
+//QAD_Timer32 Control Method
+//
+//Used to set the callback delegate to be called when the alarm count set by setAlarm() is reached
+//The delegate's event data (pData) is a pointer to this QAD_Timer32 driver
+//sHandler - The callback delegate (QAT_Delegate defined in QAT_Delegate.hpp)
+void QAD_Timer32::setAlarmHandler(const QAT_Delegate& sHandler) {
+	m_sAlarmHandler = sHandler;
+}
+
+
+//QAD_Timer32::start
+//QAD_Timer32 Control Method
+//
+//Starts the 32bit counter
+//The slave timer is enabled before the master, so that no master overflow can be missed
+void QAD_Timer32::start(void) {
+
+	//Check if driver is initialized and is currently not active
+	if ((m_eInitState) && (!m_eState)) {
+
+		//Enable slave overflow interrupt
+		m_sSlave.Instance->SR    = ~TIM_SR_UIF;
+		m_sSlave.Instance->DIER |= TIM_DIER_UIE;
+
+		//Enable slave then master
+		__HAL_TIM_ENABLE(&m_sSlave);
+		__HAL_TIM_ENABLE(&m_sMaster);
+
+		//Set current driver state to active
+		m_eState = QA_Active;
+	}
+}
+
+
+//QAD_Timer32::stop
+//QAD_Timer32 Control Method
+//
+//Stops the 32bit counter. The current count is retained, and counting continues from it if start() is called again
+void QAD_Timer32::stop(void) {
+
+	//Check if driver is initialized and is currently active
+	if ((m_eInitState) && (m_eState)) {
+
+		//Disable master then slave
+		__HAL_TIM_DISABLE(&m_sMaster);
+		__HAL_TIM_DISABLE(&m_sSlave);
+
+		//Disable overflow interrupt
+		m_sSlave.Instance->DIER &= ~TIM_DIER_UIE;
+
+		//Set current driver state to inactive
+		m_eState = QA_Inactive;
+	}
+}
+
+
+//QAD_Timer32::reset
+//QAD_Timer32 Control Method
+//
+//Used to reset the 32bit count to zero
+//Any alarm that is currently set is cancelled
+void QAD_Timer32::reset(void) {
+
+	//Return if driver is not initialized
+	if (!m_eInitState)
+		return;
+
+	cancelAlarm();
+
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	m_sMaster.Instance->CNT = 0;
+	m_sSlave.Instance->CNT  = 0;
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+//QAD_Timer32::setAlarm
+//QAD_Timer32 Control Method
+//
+//Used to set an alarm to trigger the alarm handler delegate when the 32bit count reaches a particular value
+//The count value is treated as being in the future, unless its high 16bits match those of the current count and its low 16bits have
+//already been passed, in which case the alarm triggers immediately. To set an alarm for an interval from the current time use
+//setAlarm(getCount() + uInterval)
+//Only a single alarm is supported, so setting an alarm replaces any alarm that is currently set
+//uCount - The 32bit count value at which the alarm is to trigger
+void QAD_Timer32::setAlarm(uint32_t uCount) {
+
+	//Return if driver is not initialized
+	if (!m_eInitState)
+		return;
+
+	TIM_TypeDef* pSlave = m_sSlave.Instance;
+	uint16_t     uHigh  = (uint16_t)(uCount >> 16);
+
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	//Cancel any current alarm and store new alarm count
+	cancelAlarm();
+	m_uAlarm = uCount;
+
+	//If high half of count has not yet been reached then arm the slave compare, which arms the master compare when it matches
+	if ((uint16_t)pSlave->CNT != uHigh) {
+		pSlave->CCR1  = uHigh;
+		pSlave->SR    = ~TIM_SR_CC1IF;
+		pSlave->DIER |= TIM_DIER_CC1IE;
+
+		//If the slave reached the high half while being armed then the compare match may have been missed, so arm the master compare directly
+		if (((uint16_t)pSlave->CNT == uHigh) && (!(pSlave->SR & TIM_SR_CC1IF))) {
+			pSlave->DIER &= ~TIM_DIER_CC1IE;
+			armAlarmLow();
+		}
+	} else {
+
+		//High half has been reached, so arm the master compare
+		armAlarmLow();
+	}
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+//QAD_Timer32::cancelAlarm
+//QAD_Timer32 Control Method
+//
+//Used to cancel the currently set alarm
+void QAD_Timer32::cancelAlarm(void) {
+
+	//Return if driver is not initialized
+	if (!m_eInitState)
+		return;
+
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	m_sSlave.Instance->DIER  &= ~TIM_DIER_CC1IE;
+	m_sMaster.Instance->DIER &= ~TIM_DIER_CC1IE;
+	m_sSlave.Instance->SR     = ~TIM_SR_CC1IF;
+	m_sMaster.Instance->SR    = ~TIM_SR_CC1IF;
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+  //------------------------
+  //------------------------
+  //QAD_Timer32 Data Methods
+
+//QAD_Timer32::getCount
+//QAD_Timer32 Data Method
+//
+//Returns the current 32bit count
+//The high half is read before and after the low half, and the read is repeated if the master overflowed in between. This requires
+//no critical section, so can be called from both interrupts and the main loop
+uint32_t QAD_Timer32::getCount(void) {
+	uint16_t uHigh;
+	uint16_t uLow;
+
+	do {
+		uHigh = (uint16_t)m_sSlave.Instance->CNT;
+		uLow  = (uint16_t)m_sMaster.Instance->CNT;
+	} while (uHigh != (uint16_t)m_sSlave.Instance->CNT);
+
+	return ((uint32_t)uHigh << 16) | uLow;
+}
+
+
+//QAD_Timer32::getElapsed
+//QAD_Timer32 Data Method
+//
+//Returns the number of ticks elapsed since a previous count value, correctly handling a single overflow of the 32bit counter
+//uStart - A count value previously returned by getCount()
+uint32_t QAD_Timer32::getElapsed(uint32_t uStart) {
+	return getCount() - uStart;
+}
+
+
+//QAD_Timer32::getTickFrequency
+//QAD_Timer32 Data Method
+//
+//Returns the frequency in Hz at which the 32bit counter increments
+uint32_t QAD_Timer32::getTickFrequency(void) {
+	return QAD_TimerMgr::getClockSpeed(m_eMaster) / (m_uPrescaler + 1);
+}
+
+
+  //------------------------------------------
+  //------------------------------------------
+  //QAD_Timer32 Private Initialization Methods
+
+//QAD_Timer32::periphInit
+//QAD_Timer32 Private Initialization Method
+//
+//Used to initialize the clocks and timer peripherals of both timers in the pair, to link the slave to the master's trigger output and
+//to enable the interrupts
+//In the case of a failed initialization, a partial deinitialization will be performed to make sure the peripherals and clocks are all in the
+//uninitialized state
+//Returns QA_OK if successful, or QA_Fail if initialization fails
+QA_Result QAD_Timer32::periphInit(void) {
+
+	//Enable Timer Clocks
+	QAD_TimerMgr::enableClock(m_eMaster);
+	QAD_TimerMgr::enableClock(m_eSlave);
+
+	//Initialize master timer to count the prescaled timer clock over the full 16bit range
+	m_sMaster.Instance               = QAD_TimerMgr::getInstance(m_eMaster); //Set instance for master Timer peripheral
+	m_sMaster.Init.Prescaler         = m_uPrescaler;                         //Set timer prescaler
+	m_sMaster.Init.CounterMode       = TIM_COUNTERMODE_UP;                   //Set timer counter mode to count up
+	m_sMaster.Init.Period            = 0xFFFF;                               //Set timer counter period to full 16bit range
+	m_sMaster.Init.ClockDivision     = TIM_CLOCKDIVISION_DIV1;               //Unused
+	m_sMaster.Init.RepetitionCounter = 0x0;                                  //
+	m_sMaster.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;       //Preload not required as period is never changed
+
+	if (HAL_TIM_Base_Init(&m_sMaster) != HAL_OK) {
+		periphDeinit(DeinitPartial);
+		return QA_Fail;
+	}
+
+	//Initialize slave timer to count master overflows over the full 16bit range
+	m_sSlave.Instance                = QAD_TimerMgr::getInstance(m_eSlave);  //Set instance for slave Timer peripheral
+	m_sSlave.Init.Prescaler          = 0;                                    //No prescaler, so every master overflow is counted
+	m_sSlave.Init.CounterMode        = TIM_COUNTERMODE_UP;                   //Set timer counter mode to count up
+	m_sSlave.Init.Period             = 0xFFFF;                               //Set timer counter period to full 16bit range
+	m_sSlave.Init.ClockDivision      = TIM_CLOCKDIVISION_DIV1;               //Unused
+	m_sSlave.Init.RepetitionCounter  = 0x0;                                  //
+	m_sSlave.Init.AutoReloadPreload  = TIM_AUTORELOAD_PRELOAD_DISABLE;       //Preload not required as period is never changed
+
+	if (HAL_TIM_Base_Init(&m_sSlave) != HAL_OK) {
+		HAL_TIM_Base_DeInit(&m_sMaster);
+		periphDeinit(DeinitPartial);
+		return QA_Fail;
+	}
+
+	//Set master trigger output to update event
+	TIM_MasterConfigTypeDef sMasterConfig = {0};
+	sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
+	sMasterConfig.MasterSlaveMode     = TIM_MASTERSLAVEMODE_DISABLE;
+
+	//Set slave to be clocked from master trigger output
+	TIM_SlaveConfigTypeDef sSlaveConfig = {0};
+	sSlaveConfig.SlaveMode    = TIM_SLAVEMODE_EXTERNAL1;
+	sSlaveConfig.InputTrigger = QAD_TimerMgr::getPairITR(m_ePair);
+
+	if ((HAL_TIMEx_MasterConfigSynchronization(&m_sMaster, &sMasterConfig) != HAL_OK) ||
+			(HAL_TIM_SlaveConfigSynchro(&m_sSlave, &sSlaveConfig) != HAL_OK)) {
+		periphDeinit(DeinitFull);
+		return QA_Fail;
+	}
+
+	//Clear counters and flags, as the update events generated during initialization may have been counted by the slave
+	m_sMaster.Instance->CNT = 0;
+	m_sSlave.Instance->CNT  = 0;
+	m_sMaster.Instance->SR  = 0;
+	m_sSlave.Instance->SR   = 0;
+
+	//Set IRQ priorities and enable IRQs
+	//The slave's update and compare IRQs and the master's compare IRQ are used. These are the same for general purpose timers
+	HAL_NVIC_SetPriority(QAD_TimerMgr::getUpdateIRQ(m_eSlave), m_uIRQPriority, 0);
+	HAL_NVIC_SetPriority(QAD_TimerMgr::getCCIRQ(m_eSlave), m_uIRQPriority, 0);
+	HAL_NVIC_SetPriority(QAD_TimerMgr::getCCIRQ(m_eMaster), m_uIRQPriority, 0);
+	HAL_NVIC_EnableIRQ(QAD_TimerMgr::getUpdateIRQ(m_eSlave));
+	HAL_NVIC_EnableIRQ(QAD_TimerMgr::getCCIRQ(m_eSlave));
+	HAL_NVIC_EnableIRQ(QAD_TimerMgr::getCCIRQ(m_eMaster));
+
+	//Set driver states
+	m_eState     = QA_Inactive;    //Set driver as currently inactive
+	m_eInitState = QA_Initialized; //Set driver state as initialized
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_Timer32::periphDeinit
+//QAD_Timer32 Private Initialization Method
+//
+//Used to deinitialize the timer peripheral clocks and the peripherals themselves, as well as disabling the interrupts
+//eDeinitMode - Set to DeinitPartial to perform a partial deinitialization (only to be used by periphInit() method
+//              in a case where peripheral initialization has failed
+//            - Set to DeinitFull to perform a full deinitialization in a case where the driver is fully initialized
+void QAD_Timer32::periphDeinit(QAD_Timer32::DeinitMode eDeinitMode) {
+
+	//Check if full deinitialization is required
+	if (eDeinitMode) {
+
+		//Disable IRQs
+		HAL_NVIC_DisableIRQ(QAD_TimerMgr::getUpdateIRQ(m_eSlave));
+		HAL_NVIC_DisableIRQ(QAD_TimerMgr::getCCIRQ(m_eSlave));
+		HAL_NVIC_DisableIRQ(QAD_TimerMgr::getCCIRQ(m_eMaster));
+
+		//Deinitialize Timer peripherals
+		HAL_TIM_Base_DeInit(&m_sMaster);
+		HAL_TIM_Base_DeInit(&m_sSlave);
+	}
+
+	//Disable Timer Clocks
+	QAD_TimerMgr::disableClock(m_eMaster);
+	QAD_TimerMgr::disableClock(m_eSlave);
+
+	//Set States
+	m_eState     = QA_Inactive;       //Set driver as currently inactive
+	m_eInitState = QA_NotInitialized; //Set driver state as not initialized
+}
+
+
+  //-----------------------------------
+  //-----------------------------------
+  //QAD_Timer32 Private Control Methods
+
+//QAD_Timer32::armAlarmLow
+//QAD_Timer32 Private Control Method
+//
+//Used to arm the second stage of the alarm, once the high half of the count has reached that of the alarm count
+//If the low half of the count has already passed that of the alarm count, a compare event is generated by software so that the
+//alarm triggers immediately
+void QAD_Timer32::armAlarmLow(void) {
+	TIM_TypeDef* pMaster = m_sMaster.Instance;
+	uint16_t     uLow    = (uint16_t)(m_uAlarm & 0xFFFF);
+
+	pMaster->CCR1  = uLow;
+	pMaster->SR    = ~TIM_SR_CC1IF;
+	pMaster->DIER |= TIM_DIER_CC1IE;
+
+	//Force compare event if low half has already been passed
+	if (((uint16_t)pMaster->CNT >= uLow) && (!(pMaster->SR & TIM_SR_CC1IF)))
+		pMaster->EGR = TIM_EGR_CC1G;
+}
@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Chained 32bit Timer Driver                                      */
+/*   Filename: QAD_Timer32.hpp                                             */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_TIMER32_HPP_
+#define __QAD_TIMER32_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_TimerMgr.hpp"
+#include "QAT_Delegate.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------------
+//QAD_Timer32_InitStruct
+//
+//This structure is used to be able to create the QAD_Timer32 driver class
+typedef struct {
+
+	QAD_Timer_Pair    ePair;          //Timer pair to be used. Member of QAD_Timer_Pair as defined in QAD_TimerMgr.hpp
+	                                  //QAD_TimerMgr::findTimerPair() can be used to find an available pair
+
+	uint32_t          uPrescaler;     //Prescaler to be used for the master timer. The 32bit counter increments at the master timer's
+	                                  //clock speed divided by (uPrescaler+1)
+
+	uint8_t           uIRQPriority;   //IRQ Priority for overflow and alarm interrupts (a value between 0 and 15)
+
+} QAD_Timer32_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//-----------
+//QAD_Timer32
+//
+//Driver class used to provide a 32bit counter by chaining a pair of 16bit Timer peripherals
+//
+//The master timer counts the prescaled timer clock over its full 16bit range, and outputs its update event as its trigger output (TRGO).
+//The slave timer is clocked from the master's trigger output in external clock mode 1, so counts master overflows in hardware. The slave
+//provides the high 16bits of the count and the master the low 16bits, so no interrupt is required every 65536 ticks.
+//
+//getCount() reads the two counters without disabling interrupts, by re-reading the high half until it is unchanged around the read of
+//the low half. At 72MHz with no prescaler the counter wraps every 59.6 seconds, and with a prescaler of 71 it counts microseconds and
+//wraps every 71.6 minutes.
+//
+//An alarm interrupt can be set for any 32bit count value. This is done in two stages, with a slave compare match on the high half
+//then arming a master compare match on the low half, so only two interrupts are raised however long the interval.
+//
+//handler() is to be called from the IRQ handler functions of both timers in the pair. For Timer 1 both the update (TIM1_UP_IRQn) and
+//capture/compare (TIM1_CC_IRQn) IRQs are used.
+class QAD_Timer32 {
+private:
+
+	//Deinitialization mode to be used by periphDeinit() method
+	enum DeinitMode : uint8_t {
+		DeinitPartial = 0,        //Only to be used for partial deinitialization upon initialization failure in periphInit() method
+		DeinitFull                //Used for full driver deinitialization when driver is in a fully initialized state
+  };
+
+	QAD_Timer_Pair    m_ePair;         //Stores the Timer pair to be used by the driver. Member of QAD_Timer_Pair as defined in QAD_TimerMgr.hpp
+	QAD_Timer_Periph  m_eMaster;       //Stores the master Timer peripheral, which provides the low 16bits of the count
+	QAD_Timer_Periph  m_eSlave;        //Stores the slave Timer peripheral, which provides the high 16bits of the count
+
+	TIM_HandleTypeDef m_sMaster;       //Handle used by HAL functions to access the master Timer peripheral (defined in stm32f1xx_hal_tim.h)
+	TIM_HandleTypeDef m_sSlave;        //Handle used by HAL functions to access the slave Timer peripheral
+
+	uint32_t          m_uPrescaler;    //Prescaler to be used for the master timer
+	uint8_t           m_uIRQPriority;  //IRQ Priority for overflow and alarm interrupts (a value between 0 and 15)
+
+	QA_InitState      m_eInitState;    //Stores whether the driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+	QA_ActiveState    m_eState;        //Stores whether the driver is currently active. Member of QA_ActiveState enum defined in setup.hpp
+
+	QAT_Delegate      m_sOverflowHandler;  //Callback delegate to be called when the 32bit counter overflows (QAT_Delegate defined in QAT_Delegate.hpp)
+	QAT_Delegate      m_sAlarmHandler;     //Callback delegate to be called when the alarm count is reached
+
+	uint32_t          m_uAlarm;        //Count value of the currently set alarm
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+	QAD_Timer32() = delete;                       //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+	QAD_Timer32(QAD_Timer32_InitStruct& sInit) :  //The class constructor to be used, which has a reference to an initialization structure passed to it
+		m_ePair(sInit.ePair),
+		m_eMaster(QAD_TimerNone),
+		m_eSlave(QAD_TimerNone),
+		m_sMaster({0}),
+		m_sSlave({0}),
+		m_uPrescaler(sInit.uPrescaler),
+		m_uIRQPriority(sInit.uIRQPriority),
+		m_eInitState(QA_NotInitialized),
+		m_eState(QA_Inactive),
+		m_sOverflowHandler(),
+		m_sAlarmHandler(),
+		m_uAlarm(0) {
+
+		//Retrieve master and slave timers of selected pair
+		if (m_ePair < QAD_TimerPairNone) {
+			m_eMaster = QAD_TimerMgr::getPairMaster(m_ePair);
+			m_eSlave  = QAD_TimerMgr::getPairSlave(m_ePair);
+		}
+	}
+
+	~QAD_Timer32() {       //Destructor to make sure peripheral is made inactive and deinitialized upon class destruction
+
+		//Stop timer driver if currently active
+		if (m_eState)
+			stop();
+
+		//Deinitialize timer driver if currently initialized
+		if (m_eInitState)
+			deinit();
+	}
+
+
+	//NOTE: See QAD_Timer32.cpp for details of the following functions
+
+	//----------------------
+	//Initialization Methods
+
+	QA_Result init(void);
+	void deinit(void);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	void handler(void);
+
+
+	//---------------
+	//Control Methods
+
+	void setOverflowHandler(const QAT_Delegate& sHandler);
+	void setAlarmHandler(const QAT_Delegate& sHandler);
+
+	void start(void);
+	void stop(void);
+
+	void reset(void);
+
+	void setAlarm(uint32_t uCount);
+	void cancelAlarm(void);
+
+
+	//------------
+	//Data Methods
+
+	uint32_t getCount(void);
+	uint32_t getElapsed(uint32_t uStart);
+
+	uint32_t getTickFrequency(void);
+
+private:
+
+	//------------------------------
+	//Private Initialization Methods
+
+	QA_Result periphInit(void);
+	void periphDeinit(DeinitMode eDeinitMode);
+
+
+	//-----------------------
+	//Private Control Methods
+
+	void armAlarmLow(void);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_TIMER32_HPP_ */
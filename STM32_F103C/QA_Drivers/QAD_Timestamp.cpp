@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Timestamp Driver                                                */
+/*   Filename: QAD_Timestamp.cpp                                           */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_Timestamp.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+  //-----------------------------------------
+	//-----------------------------------------
+	//QAD_Timestamp Private Initialization Methods
+
+//QAD_Timestamp::imp_init
+//QAD_Timestamp Private Initialization Method
+//
+//To be called from static method init()
+//Enables the trace block and DWT cycle counter, resets the counter and stores the current core clock frequency
+//Returns QA_OK if successful, or QA_Error_PeriphNotSupported if the cycle counter does not advance once enabled
+QA_Result QAD_Timestamp::imp_init(void) {
+
+	//Store core clock details for time conversions
+	SystemCoreClockUpdate();
+	m_uCoreClock   = SystemCoreClock;
+	m_uCyclesPerUS = (SystemCoreClock / 1000000);
+
+	//Enable trace block, then reset and enable cycle counter
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT       = 0;
+	DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+	m_uHigh = 0;
+	m_uLast = 0;
+
+	__set_PRIMASK(uPriMask);
+
+	//Check that cycle counter is running, as some F103 compatible devices do not implement it
+	__NOP();
+	__NOP();
+	if (!DWT->CYCCNT) {
+		m_eInitState = QA_NotInitialized;
+		return QA_Error_PeriphNotSupported;
+	}
+
+	//Set initialization state
+	m_eInitState = QA_Initialized;
+	return QA_OK;
+}
+
+
+  //------------------------------------
+	//------------------------------------
+	//QAD_Timestamp Private Timestamp Methods
+
+//QAD_Timestamp::imp_getCycles64
+//QAD_Timestamp Private Timestamp Method
+//
+//To be called from static methods getCycles64() and update()
+//Extends the 32bit cycle counter to 64bits by incrementing the upper 32bits whenever the counter is seen to have wrapped
+//Returns the current 64bit extended cycle count
+uint64_t QAD_Timestamp::imp_getCycles64(void) {
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	uint32_t uCycles = DWT->CYCCNT;
+	if (uCycles < m_uLast)
+		m_uHigh++;
+	m_uLast = uCycles;
+	uint64_t uResult = (((uint64_t)m_uHigh << 32) | uCycles);
+
+	__set_PRIMASK(uPriMask);
+	return uResult;
+}
+
+
+  //-------------------------------------
+	//-------------------------------------
+	//QAD_Timestamp Private Conversion Methods
+
+//QAD_Timestamp::imp_cyclesToTime
+//QAD_Timestamp Private Conversion Method
+//
+//To be called from static conversion methods
+//Converts a number of core clock cycles into a time unit. Whole seconds and the remaining cycles are converted separately to prevent
+//the intermediate multiplication from overflowing for large cycle counts
+//uCycles         - the number of core clock cycles to be converted
+//uUnitsPerSecond - the number of the required time units per second (e.g. 1000000 for microseconds)
+//Returns the converted time, or 0 if the driver has not been initialized
+uint64_t QAD_Timestamp::imp_cyclesToTime(uint64_t uCycles, uint32_t uUnitsPerSecond) {
+	if (!m_uCoreClock)
+		return 0;
+
+	uint64_t uSeconds = (uCycles / m_uCoreClock);
+	uint64_t uRemain  = (uCycles % m_uCoreClock);
+	return ((uSeconds * uUnitsPerSecond) + ((uRemain * uUnitsPerSecond) / m_uCoreClock));
+}
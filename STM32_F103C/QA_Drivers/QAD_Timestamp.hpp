@@ -0,0 +1,233 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: Timestamp Driver                                                */
+/*   Filename: QAD_Timestamp.hpp                                           */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_TIMESTAMP_HPP_
+#define __QAD_TIMESTAMP_HPP_
+
+//Includes
+#include "setup.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------
+//QAD_Timestamp
+//
+//Singleton class
+//Provides a monotonic, cycle accurate timestamp using the Cortex-M3 Data Watchpoint and Trace (DWT) unit's cycle counter (CYCCNT)
+//
+//The 32bit cycle counter wraps roughly every 59.6 seconds at 72MHz, so is extended to 64bits in software. The extension relies on
+//getCycles64() being called at least once per counter wrap, which is handled by calling update() from SysTick_Handler in handlers.cpp
+//
+//getCycles() is a single register read and is intended for short latency measurements within drivers, along with the elapsed helpers,
+//as unsigned subtraction of two 32bit readings remains correct across a single counter wrap.
+//
+//init() is to be called before any other method is used, as the cycle counter is not guaranteed to be running until then. Before init()
+//the time conversions use the core clock frequency at the time the singleton was first used, and delayUS() returns immediately
+class QAD_Timestamp {
+private:
+
+	QA_InitState m_eInitState;   //Stores whether the timestamp driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+
+	uint32_t     m_uCoreClock;   //Core clock frequency in Hz at the time of initialization, used for time conversions
+	uint32_t     m_uCyclesPerUS; //Number of core clock cycles per microsecond
+
+	uint32_t     m_uHigh;        //Upper 32bits of the extended 64bit cycle count
+	uint32_t     m_uLast;        //Cycle counter value at the time of the previous 64bit read, used to detect counter wraps
+
+	//------------
+	//Constructors
+	QAD_Timestamp() :
+		m_eInitState(QA_NotInitialized),
+		m_uCoreClock(SystemCoreClock),
+		m_uCyclesPerUS(SystemCoreClock / 1000000),
+		m_uHigh(0),
+		m_uLast(0) {}
+
+public:
+
+	//------------------------------------------------------------------------------
+	//Delete copy constructor and assignment operator due to being a singleton class
+	QAD_Timestamp(const QAD_Timestamp& other) = delete;
+	QAD_Timestamp& operator=(const QAD_Timestamp& other) = delete;
+
+
+	//-----------------
+	//Singleton Methods
+	//
+	//Used to retrieve a reference to the singleton class
+	static QAD_Timestamp& get(void) {
+		static QAD_Timestamp instance;
+		return instance;
+	}
+
+
+	//----------------------
+	//Initialization Methods
+
+	//Used to enable the DWT cycle counter and to store the current core clock frequency for time conversions
+	//Is to be called after SystemInitialize() has configured the system clocks, and again if the core clock frequency is changed
+	//Returns QA_OK if successful, or QA_Error_PeriphNotSupported if the cycle counter is not running
+	static QA_Result init(void) {
+		return get().imp_init();
+	}
+
+	//Returns whether the timestamp driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+	static QA_InitState getInitState(void) {
+		return get().m_eInitState;
+	}
+
+
+	//------------------
+	//Timestamp Methods
+
+	//Returns the current 32bit cycle count
+	static inline uint32_t getCycles(void) {
+		return DWT->CYCCNT;
+	}
+
+	//Returns the current 64bit extended cycle count
+	static uint64_t getCycles64(void) {
+		return get().imp_getCycles64();
+	}
+
+	//Used to keep the 64bit extended cycle count up to date
+	//Is to be called from SysTick_Handler in handlers.cpp, or at least once every 2^32 core clock cycles
+	static void update(void) {
+		get().imp_getCycles64();
+	}
+
+	//Returns the time in nanoseconds since the timestamp driver was initialized
+	static uint64_t getNS(void) {
+		return cyclesToNS(getCycles64());
+	}
+
+	//Returns the time in microseconds since the timestamp driver was initialized
+	static uint64_t getUS(void) {
+		return cyclesToUS(getCycles64());
+	}
+
+	//Returns the time in milliseconds since the timestamp driver was initialized
+	static uint64_t getMS(void) {
+		return cyclesToMS(getCycles64());
+	}
+
+
+	//----------------
+	//Elapsed Methods
+
+	//Returns the number of cycles that have passed since a 32bit cycle count was taken using getCycles()
+	//uStart - the cycle count at the start of the period being measured
+	static inline uint32_t elapsedCycles(uint32_t uStart) {
+		return (DWT->CYCCNT - uStart);
+	}
+
+	//Returns the number of nanoseconds that have passed since a 32bit cycle count was taken using getCycles()
+	//uStart - the cycle count at the start of the period being measured
+	static uint32_t elapsedNS(uint32_t uStart) {
+		return (uint32_t)cyclesToNS(elapsedCycles(uStart));
+	}
+
+	//Returns the number of microseconds that have passed since a 32bit cycle count was taken using getCycles()
+	//uStart - the cycle count at the start of the period being measured
+	static uint32_t elapsedUS(uint32_t uStart) {
+		return (elapsedCycles(uStart) / get().m_uCyclesPerUS);
+	}
+
+	//Returns the number of cycles that have passed since a 64bit cycle count was taken using getCycles64()
+	//uStart - the cycle count at the start of the period being measured
+	static uint64_t elapsedCycles64(uint64_t uStart) {
+		return (getCycles64() - uStart);
+	}
+
+
+	//-------------------
+	//Conversion Methods
+
+	//Returns the number of nanoseconds represented by a number of core clock cycles
+	static uint64_t cyclesToNS(uint64_t uCycles) {
+		return get().imp_cyclesToTime(uCycles, 1000000000);
+	}
+
+	//Returns the number of microseconds represented by a number of core clock cycles
+	static uint64_t cyclesToUS(uint64_t uCycles) {
+		return get().imp_cyclesToTime(uCycles, 1000000);
+	}
+
+	//Returns the number of milliseconds represented by a number of core clock cycles
+	static uint64_t cyclesToMS(uint64_t uCycles) {
+		return get().imp_cyclesToTime(uCycles, 1000);
+	}
+
+	//Returns the number of core clock cycles in a number of nanoseconds
+	static uint64_t nsToCycles(uint64_t uNS) {
+		return ((uNS * get().m_uCyclesPerUS) / 1000);
+	}
+
+	//Returns the number of core clock cycles in a number of microseconds
+	static uint64_t usToCycles(uint64_t uUS) {
+		return (uUS * get().m_uCyclesPerUS);
+	}
+
+	//Returns the core clock frequency in Hz used for time conversions
+	static uint32_t getCoreClock(void) {
+		return get().m_uCoreClock;
+	}
+
+
+	//--------------
+	//Delay Methods
+
+	//Used to busy-wait for a number of microseconds
+	//Returns immediately if the timestamp driver is not initialized, as the cycle counter may not be running
+	//uUS - the number of microseconds to wait. Must be less than 2^32 core clock cycles (roughly 59 seconds at 72MHz)
+	static void delayUS(uint32_t uUS) {
+		if (!get().m_eInitState)
+			return;
+
+		uint32_t uStart  = getCycles();
+		uint32_t uCycles = uUS * get().m_uCyclesPerUS;
+		while (elapsedCycles(uStart) < uCycles) {}
+	}
+
+private:
+
+	//NOTE: See QAD_Timestamp.cpp for details of the following methods
+
+	//----------------------
+	//Initialization Methods
+	QA_Result imp_init(void);
+
+
+	//-----------------
+	//Timestamp Methods
+	uint64_t imp_getCycles64(void);
+
+
+	//------------------
+	//Conversion Methods
+	uint64_t imp_cyclesToTime(uint64_t uCycles, uint32_t uUnitsPerSecond);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_TIMESTAMP_HPP_ */
@@ -178,6 +178,42 @@ QA_ActiveState QAD_UART::getRXState(void) {
 }
 
 
+//QAD_UART::startTC
+//QAD_UART Control Method
+//
+//Used to enable the Transmission Complete (TC) interrupt
+//TC is raised once the final stop bit has left the transmit shift register, and is used to release RS-485 transceivers
+void QAD_UART::startTC(void) {
+
+	//Enable Transmission Complete (TC) interrupt
+	__HAL_UART_ENABLE_IT(&m_sHandle, UART_IT_TC);
+}
+
+
+//QAD_UART::stopTC
+//QAD_UART Control Method
+//
+//Used to disable the Transmission Complete (TC) interrupt
+void QAD_UART::stopTC(void) {
+
+	//Disable Transmission Complete (TC) interrupt
+	__HAL_UART_DISABLE_IT(&m_sHandle, UART_IT_TC);
+}
+
+
+//QAD_UART::setReceiverState
+//QAD_UART Control Method
+//
+//Used to enable or disable the UART peripheral's receiver block (RE bit of CR1)
+//Disabling the receiver prevents a half-duplex transceiver from echoing transmitted data back into the receive path
+//eState - QA_Active to enable the receiver, or QA_Inactive to disable it
+void QAD_UART::setReceiverState(QA_ActiveState eState) {
+	if (eState)
+		SET_BIT(m_sHandle.Instance->CR1, USART_CR1_RE); else
+		CLEAR_BIT(m_sHandle.Instance->CR1, USART_CR1_RE);
+}
+
+
   //--------------------------
   //--------------------------
   //QAD_UART Transceive Method
@@ -285,6 +321,7 @@ void QAD_UART::periphDeinit(QAD_UART::DeinitMode eDeinitMode) {
 
 		//Disable IRQs
 		stopTX();                                          //Disable TX IRQ
+		stopTC();                                          //Disable TX Complete IRQ
 		stopRX();                                          //Disable RX IRQ
 		HAL_NVIC_DisableIRQ(QAD_UARTMgr::getIRQ(m_eUART)); //Disable overall UART IRQ
 
@@ -160,6 +160,11 @@ public:
 	void stopRX(void);
 	QA_ActiveState getRXState(void);
 
+	void startTC(void);
+	void stopTC(void);
+
+	void setReceiverState(QA_ActiveState eState);
+
 	  //------------------
 	  //Transceive Methods
 
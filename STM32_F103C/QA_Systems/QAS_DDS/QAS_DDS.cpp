@@ -0,0 +1,315 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Systems - DDS Signal Generator                                */
+/*   Role: Direct Digital Synthesis Signal Generator                       */
+/*   Filename: QAS_DDS.cpp                                                 */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_DDS.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//Definition of waveform lookup tables, required as they are odr-used by getTable() and setWaveform()
+constexpr QAS_DDS_Table QAS_DDS::m_sTables[QAS_DDS_WaveformCount];
+
+
+  //------------------------------
+  //------------------------------
+  //QAS_DDS Initialization Methods
+
+//QAS_DDS::init
+//QAS_DDS Initialization Method
+//
+//Used to initialize the PWM driver used to generate the outputs and the timer driver used to generate the sample clock
+//The system is left stopped with all active outputs at the midpoint of their range, and start() is to be used to begin generation
+//Returns QA_OK if initialization successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
+QA_Result QAS_DDS::init(void) {
+	if (m_eInitState)
+		return QA_OK;
+
+	//Create PWM driver
+	QAD_PWM_InitStruct sPWMInit;
+	sPWMInit.eTimer             = m_sInit.ePWMTimer;
+	sPWMInit.uPrescaler         = 0;
+	sPWMInit.uPeriod            = 0xFFFF;
+	sPWMInit.eCounterMode       = QAD_PWM_EdgeAligned;
+	for (uint8_t i=0; i<QAD_PWM_CHANNEL_COUNT; i++) {
+		sPWMInit.sChannels[i].eActive        = m_sInit.sChannels[i].eActive;
+		sPWMInit.sChannels[i].pGPIO          = m_sInit.sChannels[i].pGPIO;
+		sPWMInit.sChannels[i].uPin           = m_sInit.sChannels[i].uPin;
+		sPWMInit.sChannels[i].eComplementary = QA_Inactive;
+		sPWMInit.sChannels[i].pGPION         = nullptr;
+		sPWMInit.sChannels[i].uPinN          = 0;
+	}
+	sPWMInit.eStream            = QA_Inactive;
+	sPWMInit.uStreamIRQPriority = 0;
+	sPWMInit.uDeadTime_ns       = 0;
+	sPWMInit.eBreak             = QA_Inactive;
+	sPWMInit.eBreakPolarity     = QAD_PWM_Break_ActiveLow;
+	sPWMInit.pBreakGPIO         = nullptr;
+	sPWMInit.uBreakPin          = 0;
+	m_pPWM = std::make_unique<QAD_PWM>(sPWMInit, m_sInit.uPWMFrequency, m_sInit.uPWMResolution);
+
+	//Initialize PWM driver
+	QA_Result eRes = m_pPWM->init();
+	if (eRes) {
+		m_pPWM.reset();
+		return eRes;
+	}
+
+	//Create timer driver
+	QAD_Timer_InitStruct sTimerInit;
+	sTimerInit.eTimer         = m_sInit.eSampleTimer;
+	sTimerInit.eMode          = QAD_TimerContinuous;
+	sTimerInit.uPrescaler     = 0;
+	sTimerInit.uPeriod        = 0xFFFF;
+	sTimerInit.uIRQPriority   = m_sInit.uIRQPriority;
+	sTimerInit.uCounterTarget = 0;
+	m_pTimer = std::make_unique<QAD_Timer>(sTimerInit, m_sInit.uSampleRate);
+
+	//Initialize timer driver
+	eRes = m_pTimer->init();
+	if (eRes) {
+		m_pTimer.reset();
+		m_pPWM->deinit();
+		m_pPWM.reset();
+		return eRes;
+	}
+
+	//Set sample() method as the update interrupt callback
+	m_pTimer->setHandler(QAT_Delegate::fromMember<QAS_DDS, &QAS_DDS::sample>(this));
+
+	//Store PWM range and achieved sample rate, and calculate phase increment
+	m_uRange      = m_pPWM->getPeriod() + 1;
+	m_uSampleRate = m_pTimer->getFrequency();
+	setFrequency(m_uFrequency_mHz);
+
+	//Set all active outputs to midpoint
+	uint16_t uVals[QAD_PWM_CHANNEL_COUNT];
+	for (uint8_t i=0; i<QAD_PWM_CHANNEL_COUNT; i++)
+		uVals[i] = (uint16_t)(m_uRange >> 1);
+	m_pPWM->setPWMVals(uVals);
+
+	//Set initialization state
+	m_eInitState = QA_Initialized;
+	return QA_OK;
+}
+
+
+//QAS_DDS::deinit
+//QAS_DDS Initialization Method
+//
+//Used to stop signal generation and deinitialize the PWM and timer drivers
+void QAS_DDS::deinit(void) {
+	if (!m_eInitState)
+		return;
+
+	//Stop signal generation
+	stop();
+
+	//Deinitialize timer and PWM drivers
+	m_pTimer->deinit();
+	m_pTimer.reset();
+	m_pPWM->deinit();
+	m_pPWM.reset();
+
+	//Set initialization state
+	m_uSampleRate = 0;
+	m_eInitState  = QA_NotInitialized;
+}
+
+
+  //---------------------------
+  //---------------------------
+  //QAS_DDS IRQ Handler Methods
+
+//QAS_DDS::handler
+//QAS_DDS IRQ Handler Method
+//
+//This method is only to be called by the interrupt request handler function of the selected sample timer from handlers.cpp
+void QAS_DDS::handler(void) {
+	if (m_pTimer)
+		m_pTimer->handler();
+}
+
+
+  //-----------------------
+  //-----------------------
+  //QAS_DDS Control Methods
+
+//QAS_DDS::start
+//QAS_DDS Control Method
+//
+//Used to start signal generation. The phase accumulator continues from where it was when stop() was last called
+void QAS_DDS::start(void) {
+	if ((!m_eInitState) || (m_eState))
+		return;
+
+	if (m_pPWM->start())
+		return;
+
+	m_pTimer->start();
+	m_eState = QA_Active;
+}
+
+
+//QAS_DDS::stop
+//QAS_DDS Control Method
+//
+//Used to stop signal generation. The sample clock is stopped first so that the PWM outputs are not updated once stopped
+void QAS_DDS::stop(void) {
+	if (!m_eState)
+		return;
+
+	m_pTimer->stop();
+	m_pPWM->stop();
+	m_eState = QA_Inactive;
+}
+
+
+//QAS_DDS::setWaveform
+//QAS_DDS Control Method
+//
+//Used to select the waveform to be generated. This takes effect from the next sample without a phase discontinuity
+//eWaveform - The waveform to be generated. Member of QAS_DDS_Waveform
+void QAS_DDS::setWaveform(QAS_DDS_Waveform eWaveform) {
+	if (eWaveform >= QAS_DDS_WaveformNone)
+		return;
+
+	m_pTable = m_sTables[eWaveform].uValues;
+}
+
+
+//QAS_DDS::setFrequency
+//QAS_DDS Control Method
+//
+//Used to set the output frequency. This takes effect from the next sample without a phase discontinuity
+//The frequency is rounded to the nearest step of the phase accumulator, which is the sample rate divided by 2^32
+//uFrequency_mHz - The output frequency in millihertz. This should be less than half of the sample rate
+void QAS_DDS::setFrequency(uint32_t uFrequency_mHz) {
+	m_uFrequency_mHz = uFrequency_mHz;
+
+	//Phase increment can only be calculated once the achieved sample rate is known
+	if (!m_uSampleRate)
+		return;
+
+	uint64_t uDivisor = (uint64_t)m_uSampleRate * 1000;
+	m_uPhaseInc = (uint32_t)((((uint64_t)uFrequency_mHz << 32) + (uDivisor >> 1)) / uDivisor);
+}
+
+
+//QAS_DDS::setAmplitude
+//QAS_DDS Control Method
+//
+//Used to set the output amplitude. Outputs are scaled about the midpoint of the PWM range, so the DC level is unchanged
+//uAmplitude - The output amplitude, with 65535 being full scale and 0 holding all outputs at the midpoint
+void QAS_DDS::setAmplitude(uint16_t uAmplitude) {
+	m_uAmplitude = uAmplitude;
+}
+
+
+//QAS_DDS::setPhaseOffset
+//QAS_DDS Control Method
+//
+//Used to set the phase offset of an individual output channel relative to the shared phase accumulator
+//eChannel     - The output channel. Member of QAD_PWM_Channel as defined in QAD_PWM.hpp
+//uPhaseOffset - Phase offset in 1/65536ths of a cycle
+void QAS_DDS::setPhaseOffset(QAD_PWM_Channel eChannel, uint16_t uPhaseOffset) {
+	if (eChannel >= QAD_PWM_CHANNEL_COUNT)
+		return;
+
+	m_uPhaseOffset[eChannel] = (uint32_t)uPhaseOffset << 16;
+}
+
+
+  //--------------------
+  //--------------------
+  //QAS_DDS Data Methods
+
+//QAS_DDS::getFrequency
+//QAS_DDS Data Method
+//
+//Returns the output frequency in millihertz, as last set by the initialization structure or setFrequency()
+uint32_t QAS_DDS::getFrequency(void) {
+	return m_uFrequency_mHz;
+}
+
+
+//QAS_DDS::getSampleRate
+//QAS_DDS Data Method
+//
+//Returns the sample rate in Hz achieved by the sample timer, or 0 if the system is not initialized
+uint32_t QAS_DDS::getSampleRate(void) {
+	return m_uSampleRate;
+}
+
+
+//QAS_DDS::getTable
+//QAS_DDS Data Method
+//
+//Returns a pointer to the QAS_DDS_TABLE_SIZE entry lookup table of a waveform, which is stored in flash
+//This allows the tables to be used by other systems, such as to fill the stream buffer of a QAD_PWM driver
+//eWaveform - The waveform. Member of QAS_DDS_Waveform
+//Returns nullptr if eWaveform is not valid
+const uint16_t* QAS_DDS::getTable(QAS_DDS_Waveform eWaveform) {
+	if (eWaveform >= QAS_DDS_WaveformNone)
+		return nullptr;
+
+	return m_sTables[eWaveform].uValues;
+}
+
+
+  //------------------------------
+  //------------------------------
+  //QAS_DDS Private Sample Methods
+
+//QAS_DDS::sample
+//QAS_DDS Private Sample Method
+//
+//Called by the sample timer's update interrupt to advance the phase accumulator and calculate the next compare value of each active channel
+//The top QAS_DDS_TABLE_BITS bits of each channel's phase select a table entry, and the next 8 bits interpolate towards the following entry.
+//The interpolated value is then scaled about the midpoint by the amplitude, and finally scaled to the PWM range
+//pData - Unused
+void QAS_DDS::sample(void* pData) {
+	const uint16_t* pTable = m_pTable;
+	uint16_t uVals[QAD_PWM_CHANNEL_COUNT];
+
+	//Advance phase accumulator
+	m_uPhase += m_uPhaseInc;
+
+	for (uint8_t i=0; i<QAD_PWM_CHANNEL_COUNT; i++) {
+		if (!m_sInit.sChannels[i].eActive) {
+			uVals[i] = 0;
+			continue;
+		}
+
+		//Lookup and interpolate table entries
+		uint32_t uPhase = m_uPhase + m_uPhaseOffset[i];
+		uint32_t uIdx   = uPhase >> (32 - QAS_DDS_TABLE_BITS);
+		int32_t  iFrac  = (int32_t)((uPhase >> (24 - QAS_DDS_TABLE_BITS)) & 0xFF);
+		int32_t  iA     = pTable[uIdx];
+		int32_t  iB     = pTable[(uIdx + 1) & (QAS_DDS_TABLE_SIZE - 1)];
+		int32_t  iVal   = iA + (((iB - iA) * iFrac) >> 8);
+
+		//Scale by amplitude about midpoint, then scale to PWM range
+		iVal = (((iVal - 32768) * (int32_t)m_uAmplitude) >> 16) + 32768;
+		uVals[i] = (uint16_t)(((uint32_t)iVal * m_uRange) >> 16);
+	}
+
+	//Write all channels to take effect on the same PWM update event
+	m_pPWM->setPWMVals(uVals);
+}
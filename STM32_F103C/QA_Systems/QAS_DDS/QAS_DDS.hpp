@@ -0,0 +1,295 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Systems - DDS Signal Generator                                */
+/*   Role: Direct Digital Synthesis Signal Generator                       */
+/*   Filename: QAS_DDS.hpp                                                 */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_DDS_HPP_
+#define __QAS_DDS_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include <memory>
+
+#include "QAD_PWM.hpp"
+#include "QAD_Timer.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------
+//QAS_DDS_TABLE_BITS
+//
+//Number of bits of the phase accumulator used to index the waveform lookup tables
+//The following 8 bits of the phase accumulator are used to linearly interpolate between table entries
+#define QAS_DDS_TABLE_BITS    8
+#define QAS_DDS_TABLE_SIZE    (1 << QAS_DDS_TABLE_BITS)
+
+
+//----------------
+//QAS_DDS_Waveform
+//
+//Used to select the waveform to be generated. All waveforms start at their midpoint and rise, so are in phase with each other
+enum QAS_DDS_Waveform : uint8_t {
+	QAS_DDS_Sine = 0,
+	QAS_DDS_Triangle,
+	QAS_DDS_Sawtooth,
+	QAS_DDS_WaveformNone
+};
+
+
+//---------------------
+//QAS_DDS_WaveformCount
+//
+//Waveform Count
+const uint8_t QAS_DDS_WaveformCount = QAS_DDS_WaveformNone;
+
+
+//-------------
+//QAS_DDS_Table
+//
+//Waveform lookup table, generated by the compiler from its constexpr constructor so that it is stored in flash with no runtime cost
+//Each table holds one cycle of a waveform as unsigned 16bit values, with the midpoint of the waveform at 32768
+struct QAS_DDS_Table {
+
+	uint16_t uValues[QAS_DDS_TABLE_SIZE];
+
+	constexpr QAS_DDS_Table(QAS_DDS_Waveform eWaveform) : uValues() {
+		for (uint32_t i=0; i<QAS_DDS_TABLE_SIZE; i++) {
+			double dVal = calcSample(eWaveform, (double)i / QAS_DDS_TABLE_SIZE);
+			int32_t iVal = (int32_t)(((dVal + 1.0) * 32767.5) + 0.5);
+			uValues[i] = (uint16_t)((iVal < 0) ? 0 : ((iVal > 65535) ? 65535 : iVal));
+		}
+	}
+
+	//Returns a sample of a waveform between -1.0 and 1.0
+	//eWaveform - The waveform. Member of QAS_DDS_Waveform
+	//dPhase    - Phase within the waveform's cycle, between 0.0 and 1.0
+	static constexpr double calcSample(QAS_DDS_Waveform eWaveform, double dPhase) {
+		switch (eWaveform) {
+			case (QAS_DDS_Sine):
+				return calcSine(dPhase);
+			case (QAS_DDS_Triangle):
+				return (dPhase < 0.25) ? (4.0 * dPhase) : ((dPhase < 0.75) ? (2.0 - (4.0 * dPhase)) : ((4.0 * dPhase) - 4.0));
+			case (QAS_DDS_Sawtooth):
+				return (dPhase < 0.5) ? (2.0 * dPhase) : ((2.0 * dPhase) - 2.0);
+			default:
+				return 0.0;
+		}
+	}
+
+	//Returns the sine of a phase between 0.0 and 1.0 cycles, using a Taylor series as std::sin() is not constexpr
+	//The phase is first reduced to between -0.25 and 0.25 cycles, over which the series is accurate to well below one 16bit step
+	static constexpr double calcSine(double dPhase) {
+		double dSign = 1.0;
+		if (dPhase > 0.5) {
+			dPhase -= 0.5;
+			dSign   = -1.0;
+		}
+		if (dPhase > 0.25)
+			dPhase = 0.5 - dPhase;
+
+		double dX    = dPhase * 6.283185307179586;
+		double dTerm = dX;
+		double dSum  = dX;
+		for (uint32_t n=1; n<10; n++) {
+			dTerm *= -(dX * dX) / (double)((2 * n) * ((2 * n) + 1));
+			dSum  += dTerm;
+		}
+		return dSign * dSum;
+	}
+};
+
+
+//--------------------------
+//QAS_DDS_Channel_InitStruct
+//
+//This structure is used to store data specific to individual output channels
+typedef struct {
+
+	QA_ActiveState eActive;      //Stores whether this output channel is active. Member of QA_ActiveState defined in setup.hpp
+
+	GPIO_TypeDef*  pGPIO;        //GPIO port to be used by this output channel
+	uint16_t       uPin;         //Pin number to be used by this output channel
+
+	uint16_t       uPhaseOffset; //Phase offset of this channel's output in 1/65536ths of a cycle (for example 21845 for 120 degrees)
+
+} QAS_DDS_Channel_InitStruct;
+
+
+//------------------
+//QAS_DDS_InitStruct
+//
+//This structure is used to be able to create the QAS_DDS system class
+typedef struct {
+
+	QAD_Timer_Periph  ePWMTimer;        //Timer peripheral to be used to generate the PWM outputs. Member of QAD_Timer_Periph
+	uint32_t          uPWMFrequency;    //PWM frequency in Hz
+	uint32_t          uPWMResolution;   //Minimum number of timer ticks per PWM period (PWM resolution)
+
+	QAD_Timer_Periph  eSampleTimer;     //Timer peripheral to be used to generate the sample clock. Member of QAD_Timer_Periph
+	uint32_t          uSampleRate;      //Sample rate in Hz. This should be no higher than the PWM frequency
+	uint8_t           uIRQPriority;     //IRQ Priority for the sample clock interrupt (a value between 0 and 15)
+
+	QAS_DDS_Waveform  eWaveform;        //Waveform to be generated. Member of QAS_DDS_Waveform
+	uint32_t          uFrequency_mHz;   //Output frequency in millihertz
+	uint16_t          uAmplitude;       //Output amplitude, with 65535 being full scale
+
+	QAS_DDS_Channel_InitStruct sChannels[QAD_PWM_CHANNEL_COUNT];  //Data for individual output channels
+
+} QAS_DDS_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//-------
+//QAS_DDS
+//
+//System class used to generate sine, triangle and sawtooth waveforms on up to four PWM outputs using direct digital synthesis
+//
+//A 32bit phase accumulator is advanced by a phase increment on each interrupt of a sample clock timer. The top 8 bits of the accumulator
+//index a waveform lookup table, and the following 8 bits linearly interpolate between adjacent entries. All channels share the same
+//accumulator, with each channel adding its own phase offset, so multi-phase outputs remain locked together. The new compare values for
+//all channels are written together using QAD_PWM::setPWMVals(), so they all change on the same PWM update event.
+//
+//The frequency resolution is the sample rate divided by 2^32 (2.3uHz at 10kHz), and each sample takes tens of instructions per channel
+//with no floating point, so output timing is set entirely by the sample clock with no jitter from the main loop.
+//
+//The lookup tables are generated at compile time by the constexpr QAS_DDS_Table constructor and are stored in flash.
+//
+//Each output is to be filtered by an RC or LC low-pass filter with a cut-off well below the PWM frequency.
+//The handler() method is to be called from the interrupt request handler of the sample timer within handlers.cpp
+class QAS_DDS {
+private:
+
+	//Waveform Lookup Tables
+	static constexpr QAS_DDS_Table m_sTables[QAS_DDS_WaveformCount] = {
+		QAS_DDS_Table(QAS_DDS_Sine),
+		QAS_DDS_Table(QAS_DDS_Triangle),
+		QAS_DDS_Table(QAS_DDS_Sawtooth)
+	};
+
+	QAS_DDS_InitStruct         m_sInit;           //Stores initialization settings for the PWM and timer drivers
+
+	std::unique_ptr<QAD_PWM>   m_pPWM;            //Pointer to QAD_PWM driver class used to generate the outputs
+	std::unique_ptr<QAD_Timer> m_pTimer;          //Pointer to QAD_Timer driver class used to generate the sample clock
+
+	QA_InitState               m_eInitState;      //Stores whether the system is currently initialized. Member of QA_InitState enum defined in setup.hpp
+	QA_ActiveState             m_eState;          //Stores whether the system is currently active. Member of QA_ActiveState enum defined in setup.hpp
+
+	const uint16_t*            m_pTable;          //Lookup table of the current waveform
+	uint32_t                   m_uPhase;          //Phase accumulator
+	uint32_t                   m_uPhaseInc;       //Phase increment added to the phase accumulator each sample
+	uint32_t                   m_uPhaseOffset[QAD_PWM_CHANNEL_COUNT];  //Phase offset of each channel, scaled to the phase accumulator
+	uint32_t                   m_uAmplitude;      //Output amplitude, with 65535 being full scale
+	uint32_t                   m_uRange;          //Number of timer ticks per PWM period (PWM period + 1)
+	uint32_t                   m_uSampleRate;     //Achieved sample rate in Hz
+	uint32_t                   m_uFrequency_mHz;  //Output frequency in millihertz
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+	QAS_DDS() = delete;                     //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+	QAS_DDS(QAS_DDS_InitStruct& sInit) :    //The class constructor to be used, which has a reference to an initialization structure passed to it
+		m_sInit(sInit),
+		m_pPWM(nullptr),
+		m_pTimer(nullptr),
+		m_eInitState(QA_NotInitialized),
+		m_eState(QA_Inactive),
+		m_pTable(m_sTables[QAS_DDS_Sine].uValues),
+		m_uPhase(0),
+		m_uPhaseInc(0),
+		m_uPhaseOffset(),
+		m_uAmplitude(0),
+		m_uRange(0),
+		m_uSampleRate(0),
+		m_uFrequency_mHz(sInit.uFrequency_mHz) {
+
+		setWaveform(sInit.eWaveform);
+		setAmplitude(sInit.uAmplitude);
+		for (uint8_t i=0; i<QAD_PWM_CHANNEL_COUNT; i++)
+			m_uPhaseOffset[i] = (uint32_t)sInit.sChannels[i].uPhaseOffset << 16;
+	}
+
+	~QAS_DDS() {  //Destructor to make sure drivers are stopped and deinitialized upon class destruction
+
+		//Deinitialize system if currently initialized
+		if (m_eInitState)
+			deinit();
+	}
+
+
+	//NOTE: See QAS_DDS.cpp for details of the following functions
+
+	//----------------------
+	//Initialization Methods
+
+	QA_Result init(void);
+	void deinit(void);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	void handler(void);
+
+
+	//---------------
+	//Control Methods
+
+	void start(void);
+	void stop(void);
+
+	void setWaveform(QAS_DDS_Waveform eWaveform);
+	void setFrequency(uint32_t uFrequency_mHz);
+	void setAmplitude(uint16_t uAmplitude);
+	void setPhaseOffset(QAD_PWM_Channel eChannel, uint16_t uPhaseOffset);
+
+
+	//------------
+	//Data Methods
+
+	uint32_t getFrequency(void);
+	uint32_t getSampleRate(void);
+
+	static const uint16_t* getTable(QAS_DDS_Waveform eWaveform);
+
+private:
+
+	//----------------------
+	//Private Sample Methods
+
+	void sample(void* pData);
+
+};
+
+
+//Compile time checks of waveform lookup tables
+static_assert(QAS_DDS_Table(QAS_DDS_Sine).uValues[0] == 32768, "QAS_DDS sine table does not start at midpoint");
+static_assert(QAS_DDS_Table(QAS_DDS_Sine).uValues[QAS_DDS_TABLE_SIZE / 4] == 65535, "QAS_DDS sine table does not peak at full scale");
+static_assert(QAS_DDS_Table(QAS_DDS_Sine).uValues[(QAS_DDS_TABLE_SIZE * 3) / 4] == 0, "QAS_DDS sine table does not fall to zero");
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_DDS_HPP_ */
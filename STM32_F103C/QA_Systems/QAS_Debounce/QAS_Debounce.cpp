@@ -0,0 +1,331 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Systems - Input Debouncing                                    */
+/*   Role: Multi-Input Debouncing System                                   */
+/*   Filename: QAS_Debounce.cpp                                            */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_Debounce.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //-----------------------------------
+  //-----------------------------------
+  //QAS_Debounce Initialization Methods
+
+//QAS_Debounce::init
+//QAS_Debounce Initialization Method
+//
+//Used to configure the pins of all used ports as inputs, and to create and initialize the timer driver used to generate the sample tick
+//when a timer is selected
+//Returns QA_OK if initialization successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
+QA_Result QAS_Debounce::init(void) {
+	if (m_eInitState)
+		return QA_OK;
+
+	//Create and initialize timer driver if a timer is selected
+	if (m_sInit.eTimer < QAD_TimerNone) {
+		QAD_Timer_InitStruct sTimerInit;
+		sTimerInit.eTimer         = m_sInit.eTimer;
+		sTimerInit.eMode          = QAD_TimerContinuous;
+		sTimerInit.uPrescaler     = 0;
+		sTimerInit.uPeriod        = 0;
+		sTimerInit.uIRQPriority   = m_sInit.uIRQPriority;
+		sTimerInit.uCounterTarget = 0;
+		m_pTimer = std::make_unique<QAD_Timer>(sTimerInit, m_sInit.uSampleRate);
+
+		QA_Result eRes = m_pTimer->init();
+		if (eRes) {
+			m_pTimer.reset();
+			return eRes;
+		}
+
+		//Set sample() method as the update interrupt callback
+		m_pTimer->setHandler(QAT_Delegate::fromMember<QAS_Debounce, &QAS_Debounce::sample>(this));
+	}
+
+	//Configure pins of all used ports as inputs
+	GPIO_InitTypeDef GPIO_Init = {0};
+	GPIO_Init.Mode  = GPIO_MODE_INPUT;
+	GPIO_Init.Speed = GPIO_SPEED_FREQ_LOW;
+	for (uint8_t i=0; i<QAS_DEBOUNCE_PORTS; i++) {
+		QAS_Debounce_Port& sPort = m_sInit.sPorts[i];
+		if ((!sPort.pGPIO) || (!sPort.uMask))
+			continue;
+
+		uint16_t uPullUp   = sPort.uMask & sPort.uPullUp;
+		uint16_t uPullDown = sPort.uMask & sPort.uPullDown & ~uPullUp;
+		uint16_t uNoPull   = sPort.uMask & ~(uPullUp | uPullDown);
+
+		if (uPullUp) {
+			GPIO_Init.Pin  = uPullUp;
+			GPIO_Init.Pull = GPIO_PULLUP;
+			HAL_GPIO_Init(sPort.pGPIO, &GPIO_Init);
+		}
+		if (uPullDown) {
+			GPIO_Init.Pin  = uPullDown;
+			GPIO_Init.Pull = GPIO_PULLDOWN;
+			HAL_GPIO_Init(sPort.pGPIO, &GPIO_Init);
+		}
+		if (uNoPull) {
+			GPIO_Init.Pin  = uNoPull;
+			GPIO_Init.Pull = GPIO_NOPULL;
+			HAL_GPIO_Init(sPort.pGPIO, &GPIO_Init);
+		}
+	}
+
+	//Set initialization state
+	m_eInitState = QA_Initialized;
+	m_eState     = QA_Inactive;
+	return QA_OK;
+}
+
+
+//QAS_Debounce::deinit
+//QAS_Debounce Initialization Method
+//
+//Used to stop sampling, deinitialize the timer driver if used, and deinitialize the pins of all used ports
+void QAS_Debounce::deinit(void) {
+	if (!m_eInitState)
+		return;
+
+	//Stop sampling
+	stop();
+
+	//Deinitialize timer driver
+	if (m_pTimer) {
+		m_pTimer->deinit();
+		m_pTimer.reset();
+	}
+
+	//Deinitialize pins
+	for (uint8_t i=0; i<QAS_DEBOUNCE_PORTS; i++) {
+		if ((m_sInit.sPorts[i].pGPIO) && (m_sInit.sPorts[i].uMask))
+			HAL_GPIO_DeInit(m_sInit.sPorts[i].pGPIO, m_sInit.sPorts[i].uMask);
+	}
+
+	//Set initialization state
+	m_eInitState = QA_NotInitialized;
+}
+
+
+  //--------------------------------
+  //--------------------------------
+  //QAS_Debounce IRQ Handler Methods
+
+//QAS_Debounce::handler
+//QAS_Debounce IRQ Handler Method
+//
+//This method is only to be called by the interrupt request handler function of the selected timer from handlers.cpp
+void QAS_Debounce::handler(void) {
+	if (m_pTimer)
+		m_pTimer->handler();
+}
+
+
+//QAS_Debounce::sample
+//QAS_Debounce IRQ Handler Method
+//
+//Used to take one sample of all used ports and update their debounced states. Called by the timer driver's update interrupt when a timer
+//is used, or otherwise to be called at a regular rate from an existing periodic interrupt such as SysTick_Handler() in handlers.cpp
+//The signature allows it to be set directly as the update callback of a QAD_Timer driver using QAT_Delegate::fromMember()
+//pData - Unused
+void QAS_Debounce::sample(void* pData) {
+	if (!m_eState)
+		return;
+
+	uint32_t uTick = ++m_uTicks;
+
+	for (uint8_t i=0; i<QAS_DEBOUNCE_PORTS; i++) {
+		const QAS_Debounce_Port& sPort = m_sInit.sPorts[i];
+		if (!sPort.pGPIO)
+			continue;
+
+		//Read all pins of the port together, with active pins read as 1
+		uint16_t uRaw   = (uint16_t)((sPort.pGPIO->IDR ^ sPort.uActiveLow) & sPort.uMask);
+
+		//Update vertical counters of pins that differ from their debounced state, and reset the counters of pins that match
+		//Each counter counts 1, 2, 3 and then wraps to 0 on the Samples'th differing sample, at which point the pin changes state
+		uint16_t uDelta = uRaw ^ m_uDebounced[i];
+		m_uCount1[i]    = (m_uCount1[i] ^ m_uCount0[i]) & uDelta;
+		m_uCount0[i]    = ~m_uCount0[i] & uDelta;
+		uint16_t uToggle = uDelta & ~(m_uCount0[i] | m_uCount1[i]);
+
+		//Update debounced state and queue press and release events
+		if (uToggle) {
+			m_uDebounced[i] ^= uToggle;
+
+			uint16_t uPress   = uToggle & m_uDebounced[i];
+			uint16_t uRelease = uToggle & ~m_uDebounced[i];
+			if (uPress)
+				pushEvents(i, uPress, QAS_Debounce_Press);
+			if (uRelease)
+				pushEvents(i, uRelease, QAS_Debounce_Release);
+
+			//Record press time of newly pressed pins for long press detection
+			if (m_sInit.uLongPressTicks) {
+				m_uLongPending[i] = (m_uLongPending[i] & ~uRelease) | uPress;
+				uint32_t uPins = uPress;
+				while (uPins) {
+					uint32_t uPin = 31 - __CLZ(uPins);
+					uPins        &= ~(1UL << uPin);
+					m_uPressTick[i][uPin] = (uint16_t)uTick;
+				}
+			}
+		}
+
+		//Check held pins for long press
+		uint32_t uHeld = m_uLongPending[i];
+		while (uHeld) {
+			uint32_t uPin = 31 - __CLZ(uHeld);
+			uHeld        &= ~(1UL << uPin);
+			if ((uint16_t)(uTick - m_uPressTick[i][uPin]) >= m_sInit.uLongPressTicks) {
+				m_uLongPending[i] &= ~(1UL << uPin);
+				pushEvents(i, (uint16_t)(1UL << uPin), QAS_Debounce_LongPress);
+			}
+		}
+	}
+}
+
+
+  //----------------------------
+  //----------------------------
+  //QAS_Debounce Control Methods
+
+//QAS_Debounce::start
+//QAS_Debounce Control Method
+//
+//Used to start sampling. The debounced states are set to the current pin states so that no events are sent for inputs that are already
+//active, and the event queue is cleared
+void QAS_Debounce::start(void) {
+	if ((!m_eInitState) || (m_eState))
+		return;
+
+	for (uint8_t i=0; i<QAS_DEBOUNCE_PORTS; i++) {
+		const QAS_Debounce_Port& sPort = m_sInit.sPorts[i];
+		m_uDebounced[i]   = (sPort.pGPIO) ? (uint16_t)((sPort.pGPIO->IDR ^ sPort.uActiveLow) & sPort.uMask) : 0;
+		m_uCount0[i]      = 0;
+		m_uCount1[i]      = 0;
+		m_uLongPending[i] = 0;
+	}
+	m_uTicks = 0;
+	m_sEvents.clear();
+
+	m_eState = QA_Active;
+	if (m_pTimer)
+		m_pTimer->start();
+}
+
+
+//QAS_Debounce::stop
+//QAS_Debounce Control Method
+//
+//Used to stop sampling
+void QAS_Debounce::stop(void) {
+	if (!m_eState)
+		return;
+
+	if (m_pTimer)
+		m_pTimer->stop();
+	m_eState = QA_Inactive;
+}
+
+
+  //-------------------------
+  //-------------------------
+  //QAS_Debounce Data Methods
+
+//QAS_Debounce::getState
+//QAS_Debounce Data Method
+//
+//Returns the debounced state of all pins of a port, with active pins set to 1
+//uPort - Index of the port within the initialization structure's sPorts array
+uint16_t QAS_Debounce::getState(uint8_t uPort) {
+	return (uPort < QAS_DEBOUNCE_PORTS) ? m_uDebounced[uPort] : 0;
+}
+
+
+//QAS_Debounce::getPin
+//QAS_Debounce Data Method
+//
+//Returns true if a pin is currently active
+//uPort - Index of the port within the initialization structure's sPorts array
+//uPin  - Pin number within the port (0 to 15)
+bool QAS_Debounce::getPin(uint8_t uPort, uint8_t uPin) {
+	return (getState(uPort) >> uPin) & 0x1;
+}
+
+
+//QAS_Debounce::readEvents
+//QAS_Debounce Data Method
+//
+//Used to read a batch of events from the event queue, oldest first. This is only to be called from a single context, such as the main loop
+//pEvents - Buffer to copy the events into
+//uMax    - Maximum number of events to be read (size of pEvents)
+//Returns the number of events read
+uint32_t QAS_Debounce::readEvents(QAS_Debounce_Event* pEvents, uint32_t uMax) {
+	return m_sEvents.read(pEvents, uMax);
+}
+
+
+//QAS_Debounce::getEventCount
+//QAS_Debounce Data Method
+//
+//Returns the number of events waiting in the event queue
+uint32_t QAS_Debounce::getEventCount(void) {
+	return m_sEvents.getCount();
+}
+
+
+//QAS_Debounce::getDropped
+//QAS_Debounce Data Method
+//
+//Returns the number of events dropped due to the event queue being full since the system was started
+uint32_t QAS_Debounce::getDropped(void) {
+	return m_sEvents.getDropped();
+}
+
+
+  //---------------------------------
+  //---------------------------------
+  //QAS_Debounce Private Data Methods
+
+//QAS_Debounce::pushEvents
+//QAS_Debounce Private Data Method
+//
+//Used by sample() to write an event to the event queue for each pin in a mask, dropping events if the queue is full
+//uPort - Index of the port
+//uPins - Mask of pins
+//eType - Type of event. Member of QAS_Debounce_EventType
+void QAS_Debounce::pushEvents(uint8_t uPort, uint16_t uPins, QAS_Debounce_EventType eType) {
+	uint32_t uMask = uPins;
+
+	while (uMask) {
+		uint32_t uPin = 31 - __CLZ(uMask);
+		uMask        &= ~(1UL << uPin);
+
+		QAS_Debounce_Event* pEvent = m_sEvents.reserve();
+		if (pEvent) {
+			pEvent->uPort = uPort;
+			pEvent->uPin  = (uint8_t)uPin;
+			pEvent->eType = eType;
+		}
+	}
+
+	//Publish all events of the mask together
+	m_sEvents.publish();
+}
@@ -0,0 +1,228 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Systems - Input Debouncing                                    */
+/*   Role: Multi-Input Debouncing System                                   */
+/*   Filename: QAS_Debounce.hpp                                            */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_DEBOUNCE_HPP_
+#define __QAS_DEBOUNCE_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include <memory>
+
+#include "QAD_Timer.hpp"
+#include "QAT_Queue.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------
+//QAS_DEBOUNCE_PORTS
+//
+//Number of GPIO ports that can be sampled (GPIOA to GPIOC on the Blue Pill)
+#define QAS_DEBOUNCE_PORTS        3
+
+
+//-----------------------
+//QAS_DEBOUNCE_QUEUE_SIZE
+//
+//Number of events held by the event queue. Must be a power of two
+#define QAS_DEBOUNCE_QUEUE_SIZE   16
+
+
+//----------------------
+//QAS_Debounce_EventType
+//
+//Used to identify the type of a debounced input event
+enum QAS_Debounce_EventType : uint8_t {
+	QAS_Debounce_Press = 0,      //Input has become active (after QAS_Debounce::Samples consistent samples)
+	QAS_Debounce_Release,        //Input has become inactive
+	QAS_Debounce_LongPress       //Input has been held active for the long press time. Sent once per press, before the release event
+};
+
+
+//------------------
+//QAS_Debounce_Event
+//
+//Structure used to hold an event read from the event queue
+typedef struct {
+
+	uint8_t                uPort;  //Index of the port within the initialization structure's sPorts array
+	uint8_t                uPin;   //Pin number within the port (0 to 15)
+	QAS_Debounce_EventType eType;  //Type of event. Member of QAS_Debounce_EventType
+
+} QAS_Debounce_Event;
+
+
+//-----------------
+//QAS_Debounce_Port
+//
+//This structure is used to store data specific to individual GPIO ports
+typedef struct {
+
+	GPIO_TypeDef*     pGPIO;       //GPIO port to be sampled, or NULL if unused
+	uint16_t          uMask;       //Mask of pins to be debounced (GPIO_PIN_x values combined together)
+	uint16_t          uActiveLow;  //Mask of pins that are active when low, such as buttons connected to ground
+	uint16_t          uPullUp;     //Mask of pins to be configured with pull-up resistors
+	uint16_t          uPullDown;   //Mask of pins to be configured with pull-down resistors
+	                               //Pins in neither mask are configured with no pull resistors
+
+} QAS_Debounce_Port;
+
+
+//-----------------------
+//QAS_Debounce_InitStruct
+//
+//This structure is used to be able to create the QAS_Debounce system class
+typedef struct {
+
+	QAD_Timer_Periph  eTimer;          //Timer peripheral to be used to generate the sample tick. Member of QAD_Timer_Periph
+	                                   //Set to QAD_TimerNone to call sample() from an existing tick instead, such as SysTick_Handler()
+	uint32_t          uSampleRate;     //Sample rate in Hz when a timer is used. Inputs change state after QAS_Debounce::Samples samples
+	uint8_t           uIRQPriority;    //IRQ Priority for the sample timer's update interrupt (a value between 0 and 15)
+
+	uint16_t          uLongPressTicks; //Number of samples an input must be held active for a long press event, or 0 to disable long press events
+
+	QAS_Debounce_Port sPorts[QAS_DEBOUNCE_PORTS];  //Data for individual ports
+
+} QAS_Debounce_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//------------
+//QAS_Debounce
+//
+//System class used to debounce up to 16 inputs on each of several GPIO ports from a single periodic tick
+//
+//Each tick reads the whole input data register of each port, and debounces all 16 pins in parallel using a vertical counter. The two
+//bits of each pin's counter are held in the same bit position of two 16bit words, so all counters are updated together with a handful
+//of bitwise operations. A pin's counter is reset whenever its sample matches its debounced state, and its debounced state changes once it
+//has differed for Samples consecutive samples. The cost of each tick is therefore the same for one input or sixteen on each port.
+//
+//Press and release events are found as the bits that changed state, and are written to an event queue that is drained in batches by
+//readEvents() from the main loop. Long press events are found from the sample count at which each input was pressed, and only pins that
+//are currently held and have not yet sent a long press are examined.
+//
+//The tick is either generated by a QAD_Timer owned by the system, or sample() can be called from an existing periodic interrupt such as
+//SysTick_Handler() in handlers.cpp. When a timer is used, the handler() method is to be called from the interrupt request handler of the
+//selected timer within handlers.cpp
+class QAS_Debounce {
+public:
+
+	//Number of consecutive samples that an input must differ from its debounced state before the state changes (fixed by the
+	//two bit vertical counter)
+	static constexpr uint32_t Samples = 4;
+
+private:
+
+	QAS_Debounce_InitStruct    m_sInit;           //Stores initialization settings
+
+	std::unique_ptr<QAD_Timer> m_pTimer;          //Pointer to QAD_Timer driver class used to generate the sample tick
+
+	QA_InitState               m_eInitState;      //Stores whether the system is currently initialized. Member of QA_InitState enum defined in setup.hpp
+	QA_ActiveState             m_eState;          //Stores whether the system is currently active. Member of QA_ActiveState enum defined in setup.hpp
+
+	uint32_t                   m_uTicks;          //Number of samples taken since the system was started
+
+	uint16_t                   m_uDebounced[QAS_DEBOUNCE_PORTS];  //Debounced state of each port (1 for active)
+	uint16_t                   m_uCount0[QAS_DEBOUNCE_PORTS];     //Bit 0 of each pin's vertical counter
+	uint16_t                   m_uCount1[QAS_DEBOUNCE_PORTS];     //Bit 1 of each pin's vertical counter
+	uint16_t                   m_uLongPending[QAS_DEBOUNCE_PORTS];//Pins that are held and have not yet sent a long press event
+
+	uint16_t                   m_uPressTick[QAS_DEBOUNCE_PORTS][16];  //Low 16bits of the sample count at which each pin was pressed
+
+	QAT_Queue<QAS_Debounce_Event, QAS_DEBOUNCE_QUEUE_SIZE> m_sEvents;  //Event queue, only written by sample() (QAT_Queue defined in QAT_Queue.hpp)
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+	QAS_Debounce() = delete;                        //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+	QAS_Debounce(QAS_Debounce_InitStruct& sInit) :  //The class constructor to be used, which has a reference to an initialization structure passed to it
+		m_sInit(sInit),
+		m_pTimer(nullptr),
+		m_eInitState(QA_NotInitialized),
+		m_eState(QA_Inactive),
+		m_uTicks(0),
+		m_uDebounced(),
+		m_uCount0(),
+		m_uCount1(),
+		m_uLongPending(),
+		m_uPressTick(),
+		m_sEvents() {}
+
+	~QAS_Debounce() {  //Destructor to make sure the timer driver is stopped and deinitialized upon class destruction
+
+		//Deinitialize system if currently initialized
+		if (m_eInitState)
+			deinit();
+	}
+
+
+	//NOTE: See QAS_Debounce.cpp for details of the following functions
+
+	//----------------------
+	//Initialization Methods
+
+	QA_Result init(void);
+	void deinit(void);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	void handler(void);
+	void sample(void* pData);
+
+
+	//---------------
+	//Control Methods
+
+	void start(void);
+	void stop(void);
+
+
+	//------------
+	//Data Methods
+
+	uint16_t getState(uint8_t uPort);
+	bool getPin(uint8_t uPort, uint8_t uPin);
+
+	uint32_t readEvents(QAS_Debounce_Event* pEvents, uint32_t uMax);
+	uint32_t getEventCount(void);
+	uint32_t getDropped(void);
+
+private:
+
+	//--------------------
+	//Private Data Methods
+
+	void pushEvents(uint8_t uPort, uint16_t uPins, QAS_Debounce_EventType eType);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_DEBOUNCE_HPP_ */
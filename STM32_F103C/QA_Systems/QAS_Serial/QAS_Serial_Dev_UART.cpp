@@ -31,10 +31,22 @@
 //QAS_Serial_Dev_UART Initialization Method
 //
 //Used too initialize the UART peripheral driver
+//If RS-485 mode is enabled then the driver-enable pin is also initialized, with the transceiver left in receive mode
 //p - Unused in this implementation
 //Returns QA_OK if driver initialization is successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
 QA_Result QAS_Serial_Dev_UART::imp_init(void* p) {
-	return m_pUART->init();
+	QA_Result eRes = m_pUART->init();
+	if (eRes)
+		return eRes;
+
+	//Initialize RS-485 driver-enable pin
+	if (m_eRS485) {
+		m_pDE = std::make_unique<QAD_GPIO_Output>(m_pDE_GPIO, m_uDE_Pin, QAD_GPIO_OutputMode_PushPull,
+				                                      QAD_GPIO_PullMode_NoPull, QAD_GPIO_Speed_High);
+		m_pDE->off();
+	}
+
+	return QA_OK;
 }
 
 
@@ -44,6 +56,9 @@ QA_Result QAS_Serial_Dev_UART::imp_init(void* p) {
 //Used to deinitialize the UART peripheral driver
 void QAS_Serial_Dev_UART::imp_deinit(void) {
   m_pUART->deinit();
+
+  //Release RS-485 driver-enable pin
+  m_pDE.reset();
 }
 
 
@@ -56,7 +71,7 @@ void QAS_Serial_Dev_UART::imp_deinit(void) {
 //This method is only to be called by the interrupt request handler function from handlers.cpp
 //p - Unused in this implementation
 void QAS_Serial_Dev_UART::imp_handler(void* p) {
-  UART_HandleTypeDef pHandle = m_pUART->getHandle();
+  UART_HandleTypeDef& pHandle = m_pUART->getHandle();
 
   //RX Register Not Empty (RXNE)
   if (__HAL_UART_GET_FLAG(&pHandle, UART_FLAG_RXNE)) {
@@ -67,15 +82,33 @@ void QAS_Serial_Dev_UART::imp_handler(void* p) {
   }
 
   //TX Register Empty (TXE)
-  if (__HAL_UART_GET_FLAG(&pHandle, UART_FLAG_TXE)) {
+  //TXE flag remains set whenever the data register is empty, so the interrupt source is also checked
+  if ((__HAL_UART_GET_FLAG(&pHandle, UART_FLAG_TXE)) && (__HAL_UART_GET_IT_SOURCE(&pHandle, UART_IT_TXE))) {
   	if (!m_pTXFIFO->empty()) {
   		m_pUART->dataTX(m_pTXFIFO->pop());
   	} else {
-      m_pUART->stopTX();
-      m_eTXState = QA_Inactive;
+  		m_pUART->stopTX();
+
+  		//In RS-485 mode the final byte is still being shifted out at this point, so the bus is released from the TC interrupt
+  		if (m_eRS485) {
+  			m_pUART->startTC();
+  		} else {
+  			m_eTXState = QA_Inactive;
+  		}
   	}
   	__HAL_UART_CLEAR_FLAG(&pHandle, UART_FLAG_TXE);
   }
+
+  //Transmission Complete (TC) - Only enabled in RS-485 mode
+  if ((__HAL_UART_GET_FLAG(&pHandle, UART_FLAG_TC)) && (__HAL_UART_GET_IT_SOURCE(&pHandle, UART_IT_TC))) {
+  	m_pUART->stopTC();
+  	__HAL_UART_CLEAR_FLAG(&pHandle, UART_FLAG_TC);
+
+  	//Release driver-enable and re-enable the receiver to return the transceiver to receive mode
+  	m_pDE->off();
+  	m_pUART->setReceiverState(QA_Active);
+  	m_eTXState = QA_Inactive;
+  }
 }
 
 
@@ -86,7 +119,29 @@ void QAS_Serial_Dev_UART::imp_handler(void* p) {
 //QAS_Serial_Dev_UART Control Method
 //
 //Used to start transmission of the UART peripheral
+//In RS-485 mode the driver-enable pin is asserted and the receiver disabled before the first byte is written, unless a transmission
+//is already in progress, in which case a pending TC turnaround is cancelled so the new data follows on without releasing the bus
 void QAS_Serial_Dev_UART::imp_txStart(void) {
+
+	if (m_eRS485) {
+
+		//Prevent the UART interrupt from completing a turnaround part way through
+		uint32_t uPriMask = __get_PRIMASK();
+		__disable_irq();
+
+		m_pUART->stopTC();
+		if (!m_eTXState) {
+			m_pUART->setReceiverState(QA_Inactive);
+			m_pDE->on();
+		}
+		m_eTXState = QA_Active;
+		m_pUART->startTX();
+
+		__set_PRIMASK(uPriMask);
+		return;
+	}
+
+	m_eTXState = QA_Active;
   m_pUART->startTX();
 }
 
@@ -95,8 +150,16 @@ void QAS_Serial_Dev_UART::imp_txStart(void) {
 //QAS_Serial_Dev_UART Control Method
 //
 //Used to stop transmission of the UART peripheral
+//In RS-485 mode the driver-enable pin is released immediately and the receiver re-enabled
 void QAS_Serial_Dev_UART::imp_txStop(void) {
   m_pUART->stopTX();
+
+  if (m_eRS485) {
+  	m_pUART->stopTC();
+  	m_pDE->off();
+  	m_pUART->setReceiverState(QA_Active);
+  }
+  m_eTXState = QA_Inactive;
 }
 
 
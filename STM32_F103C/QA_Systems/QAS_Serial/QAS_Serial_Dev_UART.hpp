@@ -28,6 +28,7 @@
 #include "QAT_FIFO.hpp"
 #include "QAS_Serial_Dev_Base.hpp"
 #include "QAD_UART.hpp"
+#include "QAD_GPIO.hpp"
 
 
 	//------------------------------------------
@@ -46,6 +47,11 @@ typedef struct {
 	uint16_t            uTXFIFO_Size;   //Size in bytes of the circular FIFO buffer to be used for data transmission
 	uint16_t            uRXFIFO_Size;   //Size in bytes of the circular FIFO buffer to be used for data reception
 
+	QA_ActiveState      eRS485;         //Set to QA_Active to enable RS-485 half-duplex mode, or QA_Inactive for standard full-duplex UART
+	GPIO_TypeDef*       pDE_GPIO;       //GPIO port to be used for the RS-485 transceiver's driver-enable (DE) pin. Only used when eRS485 is QA_Active
+	uint16_t            uDE_Pin;        //Pin number to be used for the RS-485 transceiver's driver-enable (DE) pin. Only used when eRS485 is QA_Active
+	                                    //The DE pin is active high, and is held low (receive) whenever no transmission is in progress
+
 } QAS_Serial_Dev_UART_InitStruct;
 
 
@@ -59,6 +65,10 @@ typedef struct {
 //
 //This class inherits from the QAS_Serial_Dev_Base system class (defined in QAS_Serial_Dev_Base.hpp)
 //This class is used to implement serial functionality using UART peripherals
+//
+//When RS-485 mode is enabled, the DE pin is asserted (and the receiver disabled to suppress echo of the transmitted data) as soon as
+//transmission starts, and is released from the USART Transmission Complete (TC) interrupt once the final stop bit has left the transmit
+//shift register, so the bus is turned around without any delay added by application code.
 class QAS_Serial_Dev_UART : public QAS_Serial_Dev_Base {
 private:
 
@@ -66,6 +76,13 @@ private:
 
 	std::unique_ptr<QAD_UART> m_pUART;    //Pointer to QAD_UART device class
 
+	QA_ActiveState            m_eRS485;   //Stores whether RS-485 half-duplex mode is enabled
+	GPIO_TypeDef*             m_pDE_GPIO; //GPIO port used by the RS-485 driver-enable pin
+	uint16_t                  m_uDE_Pin;  //Pin number used by the RS-485 driver-enable pin
+
+	std::unique_ptr<QAD_GPIO_Output> m_pDE;  //Pointer to QAD_GPIO_Output driver class used for the RS-485 driver-enable pin
+	                                         //Only created during initialization when RS-485 mode is enabled
+
 public:
 
 	//--------------------------
@@ -77,7 +94,10 @@ public:
   QAS_Serial_Dev_UART(QAS_Serial_Dev_UART_InitStruct& sInit) :
   	QAS_Serial_Dev_Base(sInit.uTXFIFO_Size, sInit.uRXFIFO_Size, DT_UART),
 		m_ePeriph(sInit.sUART_Init.uart),
-		m_pUART(std::make_unique<QAD_UART>(sInit.sUART_Init)) {}
+		m_pUART(std::make_unique<QAD_UART>(sInit.sUART_Init)),
+		m_eRS485(sInit.eRS485),
+		m_pDE_GPIO(sInit.pDE_GPIO),
+		m_uDE_Pin(sInit.uDE_Pin) {}
 
 private:
 
@@ -0,0 +1,356 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Systems - Timer Wheel                                         */
+/*   Role: Hierarchical Software Timer Wheel                               */
+/*   Filename: QAS_TimerWheel.cpp                                          */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_TimerWheel.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //-------------------------------------
+  //-------------------------------------
+  //QAS_TimerWheel Initialization Methods
+
+//QAS_TimerWheel::init
+//QAS_TimerWheel Initialization Method
+//
+//Used to initialize the timer driver used to generate the timer wheel tick, and to start the timer wheel running
+//Returns QA_OK if initialization successful, or an error if not successful (a member of QA_Result as defined in setup.hpp)
+QA_Result QAS_TimerWheel::init(void) {
+	if (m_eInitState)
+		return QA_OK;
+
+	//Create timer driver
+	QAD_Timer_InitStruct sTimerInit;
+	sTimerInit.eTimer         = m_sTimerInit.eTimer;
+	sTimerInit.eMode          = QAD_TimerContinuous;
+	sTimerInit.uPrescaler     = m_sTimerInit.uPrescaler;
+	sTimerInit.uPeriod        = m_sTimerInit.uPeriod;
+	sTimerInit.uIRQPriority   = m_sTimerInit.uIRQPriority;
+	sTimerInit.uCounterTarget = 0;
+	m_pTimer = std::make_unique<QAD_Timer>(sTimerInit);
+
+	//Initialize timer driver
+	QA_Result eRes = m_pTimer->init();
+	if (eRes) {
+		m_pTimer.reset();
+		return eRes;
+	}
+
+	//Set tick() method as the update interrupt callback and start timer
+	m_pTimer->setHandler(QAT_Delegate::fromMember<QAS_TimerWheel, &QAS_TimerWheel::tick>(this));
+	m_pTimer->start();
+
+	//Set initialization state
+	m_eInitState = QA_Initialized;
+	return QA_OK;
+}
+
+
+//QAS_TimerWheel::deinit
+//QAS_TimerWheel Initialization Method
+//
+//Used to stop the timer wheel and deinitialize the timer driver
+//Any timers that are currently running are returned to the idle state
+void QAS_TimerWheel::deinit(void) {
+	if (!m_eInitState)
+		return;
+
+	//Stop and deinitialize timer driver
+	m_pTimer->stop();
+	m_pTimer->deinit();
+	m_pTimer.reset();
+
+	//Return all running timers to idle state
+	for (uint32_t uLevel=0; uLevel < Levels; uLevel++) {
+		for (uint32_t uSlot=0; uSlot < Slots; uSlot++) {
+			while (m_pSlots[uLevel][uSlot])
+				cancel(*m_pSlots[uLevel][uSlot]);
+		}
+	}
+	while (m_pReady)
+		cancel(*m_pReady);
+
+	//Set initialization state
+	m_eInitState = QA_NotInitialized;
+}
+
+
+  //----------------------------------
+  //----------------------------------
+  //QAS_TimerWheel IRQ Handler Methods
+
+//QAS_TimerWheel::handler
+//QAS_TimerWheel IRQ Handler Method
+//
+//This method is only to be called by the interrupt request handler function of the selected timer from handlers.cpp
+void QAS_TimerWheel::handler(void) {
+	if (m_pTimer)
+		m_pTimer->handler();
+}
+
+
+  //------------------------------
+  //------------------------------
+  //QAS_TimerWheel Control Methods
+
+//QAS_TimerWheel::start
+//QAS_TimerWheel Control Method
+//
+//Used to start a virtual timer. If the timer is already running it is restarted with the new settings
+//This method may be called from the main processing loop, from timer callbacks, or from interrupts with a priority equal to or lower
+//than that of the timer wheel
+//sTimer    - The timer structure to be started. This must remain valid for as long as the timer is running
+//uDelay    - The number of ticks until the timer first expires. A value of 0 is treated as 1, expiring on the next tick
+//            Values larger than MaxTicks (0x7FFFFFFF) are limited to MaxTicks
+//uPeriod   - The number of ticks between subsequent expiries for a periodic timer, or 0 for a one-shot timer
+//            Values larger than MaxTicks (0x7FFFFFFF) are limited to MaxTicks
+//            Periodic timers are reloaded from their previous expiry time rather than the time the callback was called, so do not drift
+//pCallback - The callback function to be called from process() when the timer expires
+//pData     - Pointer to be passed to the callback function
+void QAS_TimerWheel::start(QAS_TimerWheel_Timer& sTimer, uint32_t uDelay, uint32_t uPeriod, QAD_IRQHandler_CallbackFunction pCallback, void* pData) {
+	if (!uDelay)
+		uDelay = 1;
+
+	//Limit delay and period so that expiry times are always in the future when compared as signed differences
+	if (uDelay > MaxTicks)
+		uDelay = MaxTicks;
+	if (uPeriod > MaxTicks)
+		uPeriod = MaxTicks;
+
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	//Remove timer if already running
+	if (sTimer.eState)
+		removeTimer(&sTimer);
+
+	//Set timer details and insert into timer wheel
+	sTimer.uExpiry   = m_uTicks + (uDelay - 1);
+	sTimer.uPeriod   = uPeriod;
+	sTimer.pCallback = pCallback;
+	sTimer.pData     = pData;
+	insertTimer(&sTimer);
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+//QAS_TimerWheel::cancel
+//QAS_TimerWheel Control Method
+//
+//Used to cancel a virtual timer. If the timer has already expired but its callback has not yet been called by process(), then
+//the callback will not be called
+//sTimer - The timer structure to be cancelled
+void QAS_TimerWheel::cancel(QAS_TimerWheel_Timer& sTimer) {
+	uint32_t uPriMask = __get_PRIMASK();
+	__disable_irq();
+
+	if (sTimer.eState) {
+		removeTimer(&sTimer);
+		sTimer.eState = QAS_TimerWheel_Idle;
+	}
+
+	__set_PRIMASK(uPriMask);
+}
+
+
+//QAS_TimerWheel::getState
+//QAS_TimerWheel Control Method
+//
+//Returns the current state of a virtual timer. Member of QAS_TimerWheel_TimerState
+//sTimer - The timer structure to be checked
+QAS_TimerWheel_TimerState QAS_TimerWheel::getState(QAS_TimerWheel_Timer& sTimer) {
+	return sTimer.eState;
+}
+
+
+//QAS_TimerWheel::getTicks
+//QAS_TimerWheel Control Method
+//
+//Returns the number of ticks that have been processed since the timer wheel was created
+uint32_t QAS_TimerWheel::getTicks(void) {
+	return m_uTicks;
+}
+
+
+//QAS_TimerWheel::process
+//QAS_TimerWheel Control Method
+//
+//Used to call the callbacks of any timers that have expired. This method is to be called from the main processing loop
+//Periodic timers are reinserted into the timer wheel before their callback is called, so a callback may cancel or restart its own timer
+//Returns the number of callbacks that were called
+uint32_t QAS_TimerWheel::process(void) {
+	uint32_t uCount = 0;
+
+	while (1) {
+		uint32_t uPriMask = __get_PRIMASK();
+		__disable_irq();
+
+		//Take the first timer from the ready list
+		QAS_TimerWheel_Timer* pTimer = m_pReady;
+		if (!pTimer) {
+			__set_PRIMASK(uPriMask);
+			break;
+		}
+		removeTimer(pTimer);
+
+		QAD_IRQHandler_CallbackFunction pCallback = pTimer->pCallback;
+		void* pData = pTimer->pData;
+
+		//Reinsert periodic timers, skipping over any periods that have already passed so the timer stays in phase
+		if (pTimer->uPeriod) {
+			do {
+				pTimer->uExpiry += pTimer->uPeriod;
+			} while ((int32_t)(pTimer->uExpiry - m_uTicks) < 0);
+			insertTimer(pTimer);
+		} else {
+			pTimer->eState = QAS_TimerWheel_Idle;
+		}
+
+		__set_PRIMASK(uPriMask);
+
+		//Call timer callback with interrupts enabled
+		if (pCallback)
+			pCallback(pData);
+		uCount++;
+	}
+
+	return uCount;
+}
+
+
+  //------------------------------------------
+  //------------------------------------------
+  //QAS_TimerWheel Private IRQ Handler Methods
+
+//QAS_TimerWheel::tick
+//QAS_TimerWheel Private IRQ Handler Method
+//
+//Called through a QAT_Delegate by the QAD_Timer driver's update interrupt to process a single tick of the timer wheel
+//If the lowest level has wrapped, the next slot of each higher level is cascaded down until a level that has not wrapped is reached,
+//then all timers in the current slot of the lowest level are moved to the ready list
+//pData - Pointer to the QAD_Timer driver. Unused in this implementation
+void QAS_TimerWheel::tick(void* pData) {
+	uint32_t uTick = m_uTicks;
+	uint32_t uSlot = (uTick & SlotMask);
+
+	//Cascade higher levels
+	if (!uSlot) {
+		for (uint32_t uLevel=1; uLevel < Levels; uLevel++) {
+			uint32_t uIndex = ((uTick >> (SlotBits * uLevel)) & SlotMask);
+			cascade(uLevel, uIndex);
+			if (uIndex)
+				break;
+		}
+	}
+	m_uTicks = uTick + 1;
+
+	//Move expired timers to the end of the ready list
+	QAS_TimerWheel_Timer* pTimer = m_pSlots[0][uSlot];
+	m_pSlots[0][uSlot] = NULL;
+	while (pTimer) {
+		QAS_TimerWheel_Timer* pNext = pTimer->pNext;
+
+		pTimer->pNext  = NULL;
+		pTimer->ppPrev = m_ppReadyTail;
+		pTimer->eState = QAS_TimerWheel_Ready;
+		*m_ppReadyTail = pTimer;
+		m_ppReadyTail  = &pTimer->pNext;
+
+		pTimer = pNext;
+	}
+}
+
+
+  //-------------------------------------
+  //-------------------------------------
+  //QAS_TimerWheel Private Timer Wheel Methods
+
+//QAS_TimerWheel::insertTimer
+//QAS_TimerWheel Private Timer Wheel Method
+//
+//Used to insert a timer into the appropriate slot of the timer wheel, based on how far away its expiry time is
+//Timers that have already expired are placed into the slot for the next tick
+//Timers beyond the range of the timer wheel are placed as far away as possible, and will be moved further when they are cascaded
+//Must be called with interrupts disabled, or from the timer wheel's update interrupt
+//pTimer - The timer to be inserted
+void QAS_TimerWheel::insertTimer(QAS_TimerWheel_Timer* pTimer) {
+	uint32_t uExpiry = pTimer->uExpiry;
+	int32_t  iDelta  = (int32_t)(uExpiry - m_uTicks);
+	uint32_t uLevel  = 0;
+
+	if (iDelta < 0) {
+		uExpiry = m_uTicks;
+	} else {
+		if ((uint32_t)iDelta > MaxDelay) {
+			iDelta  = MaxDelay;
+			uExpiry = m_uTicks + MaxDelay;
+		}
+		while ((uint32_t)iDelta >= (1UL << (SlotBits * (uLevel + 1))))
+			uLevel++;
+	}
+
+	//Add timer to the head of the slot's list
+	QAS_TimerWheel_Timer** ppHead = &m_pSlots[uLevel][(uExpiry >> (SlotBits * uLevel)) & SlotMask];
+	pTimer->pNext = *ppHead;
+	if (pTimer->pNext)
+		pTimer->pNext->ppPrev = &pTimer->pNext;
+	pTimer->ppPrev = ppHead;
+	*ppHead = pTimer;
+
+	pTimer->eState = QAS_TimerWheel_Pending;
+}
+
+
+//QAS_TimerWheel::removeTimer
+//QAS_TimerWheel Private Timer Wheel Method
+//
+//Used to remove a timer from whichever slot or ready list it is currently stored in
+//Must be called with interrupts disabled
+//pTimer - The timer to be removed
+void QAS_TimerWheel::removeTimer(QAS_TimerWheel_Timer* pTimer) {
+	*pTimer->ppPrev = pTimer->pNext;
+	if (pTimer->pNext) {
+		pTimer->pNext->ppPrev = pTimer->ppPrev;
+	} else if (m_ppReadyTail == &pTimer->pNext) {
+		m_ppReadyTail = pTimer->ppPrev;
+	}
+
+	pTimer->pNext  = NULL;
+	pTimer->ppPrev = NULL;
+}
+
+
+//QAS_TimerWheel::cascade
+//QAS_TimerWheel Private Timer Wheel Method
+//
+//Used to redistribute all timers within a slot of a higher level into the lower levels of the timer wheel
+//uLevel - The level of the slot to be cascaded
+//uSlot  - The index of the slot to be cascaded
+void QAS_TimerWheel::cascade(uint32_t uLevel, uint32_t uSlot) {
+	QAS_TimerWheel_Timer* pTimer = m_pSlots[uLevel][uSlot];
+	m_pSlots[uLevel][uSlot] = NULL;
+
+	while (pTimer) {
+		QAS_TimerWheel_Timer* pNext = pTimer->pNext;
+		insertTimer(pTimer);
+		pTimer = pNext;
+	}
+}
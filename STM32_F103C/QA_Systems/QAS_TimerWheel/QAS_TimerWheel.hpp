@@ -0,0 +1,206 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Systems - Timer Wheel                                         */
+/*   Role: Hierarchical Software Timer Wheel                               */
+/*   Filename: QAS_TimerWheel.hpp                                          */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_TIMERWHEEL_HPP_
+#define __QAS_TIMERWHEEL_HPP_
+
+//Includes
+#include "setup.hpp"
+
+#include <memory>
+
+#include "QAD_Timer.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------------------
+//QAS_TimerWheel_TimerState
+//
+//Used to store the current state of a virtual timer
+enum QAS_TimerWheel_TimerState : uint8_t {
+	QAS_TimerWheel_Idle = 0,     //Timer is not currently running
+	QAS_TimerWheel_Pending,      //Timer is running and is stored within one of the slots of the timer wheel
+	QAS_TimerWheel_Ready         //Timer has expired and is waiting in the ready list for its callback to be called by process()
+};
+
+
+//--------------------
+//QAS_TimerWheel_Timer
+//
+//Virtual timer structure used with the QAS_TimerWheel system class
+//The structure is intrusive, meaning that the timer wheel links the timer structures together directly rather than allocating any
+//storage of its own, so insertion and cancellation are O(1) and no memory allocation takes place once the wheel has been created.
+//The structure is to be owned by the application, and must remain valid for as long as the timer is running.
+//The members of this structure are managed by QAS_TimerWheel and are not to be modified directly.
+struct QAS_TimerWheel_Timer {
+
+	QAS_TimerWheel_Timer*  pNext     = NULL;  //Pointer to the next timer in the slot or ready list
+	QAS_TimerWheel_Timer** ppPrev    = NULL;  //Pointer to the pNext member of the previous timer (or the list head pointer) that points to this timer
+
+	uint32_t               uExpiry   = 0;     //Absolute tick count at which the timer expires
+	uint32_t               uPeriod   = 0;     //Reload period in ticks for periodic timers, or 0 for one-shot timers
+
+	QAD_IRQHandler_CallbackFunction pCallback = NULL;  //Callback function to be called from process() when the timer expires
+	void*                  pData     = NULL;  //Pointer to be passed to the callback function
+
+	QAS_TimerWheel_TimerState eState = QAS_TimerWheel_Idle;  //Current state of the timer. Member of QAS_TimerWheel_TimerState
+};
+
+
+//-------------------------
+//QAS_TimerWheel_InitStruct
+//
+//This structure is used to be able to create the QAS_TimerWheel system class
+//The prescaler and period set the length of one timer wheel tick
+//For example, a prescaler of 7199 and period of 9 gives a 1ms tick from a 72MHz timer clock
+typedef struct {
+
+	QAD_Timer_Periph eTimer;        //Timer peripheral to be used. Member of QAD_Timer_Periph as defined in QAD_TimerMgr.hpp
+
+	uint32_t         uPrescaler;    //Prescaler to be used for selected timer
+	uint32_t         uPeriod;       //Counter period to be used for selected timer
+
+	uint8_t          uIRQPriority;  //IRQ Priority for update interrupt (a value between 0 and 15)
+
+} QAS_TimerWheel_InitStruct;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//--------------
+//QAS_TimerWheel
+//
+//System class used to multiplex a large number of one-shot and periodic virtual timers onto the update interrupt of a single QAD_Timer
+//
+//Timers are stored in a hierarchical (cascading) timer wheel, consisting of Levels levels of Slots slots (defined below).
+//Level 0 has a resolution of one tick, and each following level has a resolution equal to the full span of the level below it.
+//When the lowest level wraps, the timers in the next slot of the level above are re-distributed (cascaded) into the lower levels.
+//This keeps the interrupt workload independent of the number of running timers, as only the current slot needs to be examined each tick.
+//
+//The update interrupt only moves expired timers into a ready list. Callbacks are called from process(), which is to be called from the
+//main processing loop, so that callbacks are free to take as long as they need without affecting interrupt latency.
+//
+//The tick is processed by the private tick() method, which is bound to the update interrupt callback of the QAD_Timer driver by init()
+//using QAT_Delegate::fromMember(), so no callback class or function needs to be set up by the user. The handler() method only forwards
+//the timer's interrupt to the QAD_Timer driver, and is to be called from the interrupt request handler of the selected timer within
+//handlers.cpp
+class QAS_TimerWheel {
+public:
+
+	//Timer wheel dimensions
+	static constexpr uint32_t SlotBits  = 5;                                   //Number of bits of the tick count covered by each level
+	static constexpr uint32_t Slots     = (1 << SlotBits);                     //Number of slots in each level
+	static constexpr uint32_t SlotMask  = (Slots - 1);                         //Mask used to find slot index within a level
+	static constexpr uint32_t Levels    = 4;                                   //Number of levels in the timer wheel
+	static constexpr uint32_t MaxDelay  = ((1 << (SlotBits * Levels)) - 1);    //Largest delay in ticks that can be stored in the timer wheel
+	                                                                           //Longer delays are parked in the top level and re-cascaded until they expire
+	static constexpr uint32_t MaxTicks  = 0x7FFFFFFF;                          //Largest delay or period in ticks accepted by start(), as expiry times
+	                                                                           //are compared as signed differences from the current tick count
+
+private:
+
+	QAS_TimerWheel_InitStruct  m_sTimerInit;   //Stores initialization settings for the timer driver
+
+	std::unique_ptr<QAD_Timer> m_pTimer;       //Pointer to QAD_Timer driver class used to generate the timer wheel tick
+
+	QA_InitState               m_eInitState;   //Stores whether the system is currently initialized. Member of QA_InitState enum defined in setup.hpp
+
+	volatile uint32_t          m_uTicks;       //Tick count of the next tick to be processed by the update interrupt
+
+	QAS_TimerWheel_Timer*      m_pSlots[Levels][Slots];  //List heads for each slot of each level of the timer wheel
+
+	QAS_TimerWheel_Timer*      m_pReady;       //List head for the ready list
+	QAS_TimerWheel_Timer**     m_ppReadyTail;  //Pointer to the pNext member of the last timer in the ready list (or the list head pointer if empty)
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+	QAS_TimerWheel() = delete;                           //Delete the default class constructor, as we need an initialization structure to be provided on class creation
+
+	QAS_TimerWheel(QAS_TimerWheel_InitStruct& sInit) :   //The class constructor to be used, which has a reference to an initialization structure passed to it
+		m_sTimerInit(sInit),
+		m_pTimer(nullptr),
+		m_eInitState(QA_NotInitialized),
+		m_uTicks(0),
+		m_pSlots(),
+		m_pReady(NULL),
+		m_ppReadyTail(&m_pReady) {}
+
+	~QAS_TimerWheel() {  //Destructor to make sure timer driver is stopped and deinitialized upon class destruction
+
+		//Deinitialize system if currently initialized
+		if (m_eInitState)
+			deinit();
+	}
+
+
+	//NOTE: See QAS_TimerWheel.cpp for details of the following functions
+
+	//----------------------
+	//Initialization Methods
+
+	QA_Result init(void);
+	void deinit(void);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	void handler(void);
+
+
+	//---------------
+	//Control Methods
+
+	void start(QAS_TimerWheel_Timer& sTimer, uint32_t uDelay, uint32_t uPeriod, QAD_IRQHandler_CallbackFunction pCallback, void* pData);
+	void cancel(QAS_TimerWheel_Timer& sTimer);
+
+	QAS_TimerWheel_TimerState getState(QAS_TimerWheel_Timer& sTimer);
+
+	uint32_t getTicks(void);
+
+	uint32_t process(void);
+
+private:
+
+	//---------------------------
+	//Private IRQ Handler Methods
+
+	void tick(void* pData);
+
+
+	//---------------------------
+	//Private Timer Wheel Methods
+
+	void insertTimer(QAS_TimerWheel_Timer* pTimer);
+	void removeTimer(QAS_TimerWheel_Timer* pTimer);
+	void cascade(uint32_t uLevel, uint32_t uSlot);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_TIMERWHEEL_HPP_ */
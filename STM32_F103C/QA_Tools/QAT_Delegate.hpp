@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Tools                                                         */
+/*   Role: Callback Delegate                                               */
+/*   Filename: QAT_Delegate.hpp                                            */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAT_DELEGATE_HPP_
+#define __QAT_DELEGATE_HPP_
+
+//Includes
+#include "setup.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------------------
+//QAT_Delegate_StubFunction
+//
+//Function pointer type called by QAT_Delegate when invoked
+//pContext - The context pointer bound to the delegate (such as the object a member function is to be called on)
+//pData    - Event data passed by the caller of the delegate (such as a driver's interrupt handler)
+typedef void (*QAT_Delegate_StubFunction)(void* pContext, void* pData);
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//------------
+//QAT_Delegate
+//
+//Fixed size callback delegate used by drivers and systems for IRQ callbacks
+//
+//A delegate holds a stub function pointer and a context pointer, requires no heap allocation and is invoked with a single indirect call.
+//It can be bound to either:
+//  - A free function with a context pointer   - QAT_Delegate(pFunction, pContext), where pFunction is a QAT_Delegate_StubFunction
+//  - A member function of an object           - QAT_Delegate::fromMember<Class, &Class::method>(pObject)
+//  - A free function with no context          - QAT_Delegate::fromFunction<&function>()
+//  - A QAD_IRQHandler_CallbackFunction or QAD_IRQHandler_CallbackClass, to support the setHandlerFunction() and setHandlerClass() methods
+//    of existing drivers
+//
+//An unbound delegate calls an empty stub function, so delegates can be invoked without first being checked
+class QAT_Delegate {
+private:
+
+	QAT_Delegate_StubFunction m_pStub;     //Stub function called when the delegate is invoked
+	void*                     m_pContext;  //Context pointer passed to the stub function
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+	QAT_Delegate() :                                                     //Default constructor creates an unbound delegate
+		m_pStub(&stubNone),
+		m_pContext(NULL) {}
+
+	QAT_Delegate(QAT_Delegate_StubFunction pFunction, void* pContext) :  //Constructor to bind a free function with a context pointer
+		m_pStub(pFunction ? pFunction : &stubNone),
+		m_pContext(pContext) {}
+
+
+	//---------------
+	//Binding Methods
+
+	//Used to create a delegate bound to a member function of an object
+	//The member function is a template parameter, so is called directly from the stub with no virtual function call
+	//T       - The class of the object
+	//Method  - The member function to be called, which must take a single void* parameter (event data)
+	//pObject - Pointer to the object the member function is to be called on
+	template <class T, void (T::*Method)(void*)>
+	static QAT_Delegate fromMember(T* pObject) {
+		return QAT_Delegate(&stubMember<T, Method>, pObject);
+	}
+
+	//Used to create a delegate bound to a free function that takes no context pointer
+	//Function - The function to be called, which must take a single void* parameter (event data)
+	template <void (*Function)(void*)>
+	static QAT_Delegate fromFunction(void) {
+		return QAT_Delegate(&stubStatic<Function>, NULL);
+	}
+
+	//Used to create a delegate bound to a QAD_IRQHandler_CallbackFunction
+	//The function pointer is stored as the context pointer, which is supported by GCC for all ARM targets
+	//pFunction - The callback function to be called. QAD_IRQHandler_CallbackFunction defined in setup.hpp
+	static QAT_Delegate fromCallbackFunction(QAD_IRQHandler_CallbackFunction pFunction) {
+		if (!pFunction)
+			return QAT_Delegate();
+		return QAT_Delegate(&stubCallbackFunction, reinterpret_cast<void*>(pFunction));
+	}
+
+	//Used to create a delegate bound to a QAD_IRQHandler_CallbackClass
+	//pClass - The callback class whose handler() method is to be called. QAD_IRQHandler_CallbackClass defined in setup.hpp
+	static QAT_Delegate fromCallbackClass(QAD_IRQHandler_CallbackClass* pClass) {
+		if (!pClass)
+			return QAT_Delegate();
+		return QAT_Delegate(&stubCallbackClass, pClass);
+	}
+
+
+	//------------------
+	//Invocation Methods
+
+	//Used to invoke the delegate
+	//pData - Event data to be passed to the bound function
+	void operator()(void* pData) const {
+		m_pStub(m_pContext, pData);
+	}
+
+	//Returns true if the delegate is bound to a function
+	explicit operator bool() const {
+		return (m_pStub != &stubNone);
+	}
+
+	//Used to unbind the delegate
+	void clear(void) {
+		m_pStub    = &stubNone;
+		m_pContext = NULL;
+	}
+
+private:
+
+	//--------------
+	//Stub Functions
+
+	static void stubNone(void* pContext, void* pData) {}
+
+	template <class T, void (T::*Method)(void*)>
+	static void stubMember(void* pContext, void* pData) {
+		(static_cast<T*>(pContext)->*Method)(pData);
+	}
+
+	template <void (*Function)(void*)>
+	static void stubStatic(void* pContext, void* pData) {
+		Function(pData);
+	}
+
+	static void stubCallbackFunction(void* pContext, void* pData) {
+		reinterpret_cast<QAD_IRQHandler_CallbackFunction>(pContext)(pData);
+	}
+
+	static void stubCallbackClass(void* pContext, void* pData) {
+		static_cast<QAD_IRQHandler_CallbackClass*>(pContext)->handler(pData);
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAT_DELEGATE_HPP_ */
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F103C6 Blue Pill                                                */
+/*                                                                         */
+/*   System: Tools                                                         */
+/*   Role: Lock-Free Event Queue                                           */
+/*   Filename: QAT_Queue.hpp                                               */
+/*   Date: 18th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2026 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAT_QUEUE_HPP_
+#define __QAT_QUEUE_HPP_
+
+//Includes
+#include "setup.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//---------
+//QAT_Queue
+//
+//Fixed size lock-free single-producer single-consumer queue, used to pass events from an interrupt to the main loop, such as within
+//QAD_EXTIMgr and QAS_Debounce system class
+//
+//The producer is a single interrupt (or a set of interrupts that cannot preempt each other), which calls reserve() to write each item in
+//place and then publish() to make the reserved items visible to the consumer, so a batch of items can be published with a single barrier.
+//When the queue is full further items are dropped and counted. The consumer is a single context, such as the main loop, which drains
+//items in batches with read(). The head and tail are free running counts, with slots found by masking, so no locks are needed
+//T     - The item type, which is copied by read()
+//uSize - The number of items the queue can hold, which must be a power of two
+template <typename T, uint32_t uSize>
+class QAT_Queue {
+private:
+
+	static_assert((uSize != 0) && ((uSize & (uSize - 1)) == 0), "QAT_Queue size must be a power of two");
+
+	T                 m_sItems[uSize];  //Queue storage
+	uint32_t          m_uReserved;      //Number of items reserved, only used by the producer
+	volatile uint32_t m_uHead;          //Number of items published, only written by publish()
+	volatile uint32_t m_uTail;          //Number of items read, only written by read() and clear()
+	volatile uint32_t m_uDropped;       //Number of items dropped due to the queue being full
+
+public:
+
+	//--------------------------
+	//Constructors / Destructors
+
+	constexpr QAT_Queue() :             //Default constructor creates an empty queue, and is constexpr so static queues are initialized before main()
+		m_sItems(),
+		m_uReserved(0),
+		m_uHead(0),
+		m_uTail(0),
+		m_uDropped(0) {}
+
+
+	//----------------
+	//Producer Methods
+
+	//Used to reserve the next free slot, which is to be written and then made visible to the consumer by publish()
+	//Returns a pointer to the slot, or nullptr if the queue is full, in which case the item is counted as dropped
+	T* reserve(void) {
+		if ((m_uReserved - m_uTail) >= uSize) {
+			m_uDropped++;
+			return nullptr;
+		}
+		return &m_sItems[m_uReserved++ & (uSize - 1)];
+	}
+
+	//Used to publish all reserved items to the consumer
+	void publish(void) {
+		__DMB();                    //Make sure items are written before they are published to the consumer
+		m_uHead = m_uReserved;
+	}
+
+
+	//----------------
+	//Consumer Methods
+
+	//Used to read a batch of items, oldest first
+	//pItems - Buffer to copy the items into
+	//uMax   - Maximum number of items to be read (size of pItems)
+	//Returns the number of items read
+	uint32_t read(T* pItems, uint32_t uMax) {
+		uint32_t uTail  = m_uTail;
+		uint32_t uCount = m_uHead - uTail;
+		if (uCount > uMax)
+			uCount = uMax;
+
+		__DMB();                    //Make sure items are read after the head index
+		for (uint32_t i=0; i<uCount; i++)
+			pItems[i] = m_sItems[(uTail + i) & (uSize - 1)];
+		__DMB();                    //Make sure items are read before their slots are released to the producer
+
+		m_uTail = uTail + uCount;
+		return uCount;
+	}
+
+	//Returns the number of items waiting to be read
+	uint32_t getCount(void) const {
+		return m_uHead - m_uTail;
+	}
+
+	//Returns the number of items dropped due to the queue being full since clear() was last called
+	uint32_t getDropped(void) const {
+		return m_uDropped;
+	}
+
+	//Used to discard all waiting items and clear the dropped item count
+	//Interrupts are disabled so that the producer cannot run part way through
+	void clear(void) {
+		uint32_t uPriMask = __get_PRIMASK();
+		__disable_irq();
+
+		m_uTail    = m_uHead;
+		m_uDropped = 0;
+
+		__set_PRIMASK(uPriMask);
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAT_QUEUE_HPP_ */